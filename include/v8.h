@@ -1977,7 +1977,11 @@ class V8_EXPORT ScriptCompiler {
   enum CompileOptions {
     kNoCompileOptions = 0,
     kConsumeCodeCache,
-    kEagerCompile
+    kEagerCompile,
+    // Parse the script on the calling thread, and compile its eagerly compiled
+    // top-level functions on worker threads. Only applies to classic scripts
+    // compiled with Compile or CompileUnboundScript.
+    kParallelCompile
   };
 
   /**
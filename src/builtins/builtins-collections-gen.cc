@@ -1792,11 +1792,18 @@ TF_BUILTIN(MapPrototypeDelete, CollectionsBuiltinsAssembler) {
   const TNode<Smi> number_of_buckets = CAST(
       LoadFixedArrayElement(table, OrderedHashMap::NumberOfBucketsIndex()));
 
-  // If there fewer elements than #buckets / 2, shrink the table.
-  Label shrink(this);
-  GotoIf(SmiLessThan(SmiAdd(number_of_elements, number_of_elements),
+  // If there fewer elements than #buckets / 2, shrink the table. Tables of
+  // the minimum size cannot shrink any further (see OrderedHashMap::Shrink).
+  Label shrink(this), done(this);
+  GotoIfNot(SmiGreaterThan(number_of_buckets,
+                           SmiConstant(OrderedHashMap::kInitialCapacity /
+                                       OrderedHashMap::kLoadFactor)),
+            &done);
+  Branch(SmiLessThan(SmiAdd(number_of_elements, number_of_elements),
                      number_of_buckets),
-         &shrink);
+         &shrink, &done);
+
+  BIND(&done);
   Return(TrueConstant());
 
   BIND(&shrink);
@@ -1956,11 +1963,18 @@ TF_BUILTIN(SetPrototypeDelete, CollectionsBuiltinsAssembler) {
   const TNode<Smi> number_of_buckets = CAST(
       LoadFixedArrayElement(table, OrderedHashSet::NumberOfBucketsIndex()));
 
-  // If there fewer elements than #buckets / 2, shrink the table.
-  Label shrink(this);
-  GotoIf(SmiLessThan(SmiAdd(number_of_elements, number_of_elements),
+  // If there fewer elements than #buckets / 2, shrink the table. Tables of
+  // the minimum size cannot shrink any further (see OrderedHashSet::Shrink).
+  Label shrink(this), done(this);
+  GotoIfNot(SmiGreaterThan(number_of_buckets,
+                           SmiConstant(OrderedHashSet::kInitialCapacity /
+                                       OrderedHashSet::kLoadFactor)),
+            &done);
+  Branch(SmiLessThan(SmiAdd(number_of_elements, number_of_elements),
                      number_of_buckets),
-         &shrink);
+         &shrink, &done);
+
+  BIND(&done);
   Return(TrueConstant());
 
   BIND(&shrink);
@@ -377,6 +377,78 @@ TNode<String> StringBuiltinsAssembler::StringAdd(
     GotoIf(Uint32LessThan(new_length, Uint32Constant(ConsString::kMinLength)),
            &non_cons);
 
+    // When a string is built by repeatedly appending short pieces, merge the
+    // piece into the sequential right child of {left} rather than adding
+    // another ConsString on top. This keeps such ropes shallow and small.
+    // Note that TurboFan allocates the ConsString inline for additions where
+    // it knows a constant operand is long enough (see ShouldCreateConsString
+    // in JSTypedLowering), and those don't go through here.
+    Label allocate_cons(this);
+    {
+      TNode<Int32T> left_instance_type = LoadInstanceType(left);
+      GotoIfNot(IsConsStringInstanceType(left_instance_type), &allocate_cons);
+      TNode<ConsString> left_cons = CAST(left);
+      TNode<String> tail =
+          LoadObjectField<String>(left_cons, ConsString::kSecondOffset);
+      TNode<Uint32T> tail_length = LoadStringLengthAsWord32(tail);
+      TNode<Uint32T> merged_length = Uint32Add(tail_length, right_length);
+      GotoIf(Uint32GreaterThan(
+                 merged_length,
+                 Uint32Constant(ConsString::kMaxMergedSecondLength)),
+             &allocate_cons);
+
+      // Both the tail and {right} have to be sequential, with the same
+      // encoding.
+      TNode<Int32T> tail_instance_type = LoadInstanceType(tail);
+      TNode<Int32T> right_instance_type = LoadInstanceType(right);
+      STATIC_ASSERT(kSeqStringTag == 0);
+      GotoIf(IsSetWord32(Word32Or(tail_instance_type, right_instance_type),
+                         kStringRepresentationMask),
+             &allocate_cons);
+      GotoIf(IsSetWord32(Word32Xor(tail_instance_type, right_instance_type),
+                         kStringEncodingMask),
+             &allocate_cons);
+
+      TNode<IntPtrT> word_tail_length = Signed(ChangeUint32ToWord(tail_length));
+      TNode<IntPtrT> word_right_length =
+          Signed(ChangeUint32ToWord(right_length));
+      TVARIABLE(String, var_merged);
+      Label merged(this, &var_merged), two_byte(this);
+      GotoIf(Word32Equal(Word32And(right_instance_type,
+                                   Int32Constant(kStringEncodingMask)),
+                         Int32Constant(kTwoByteStringTag)),
+             &two_byte);
+      var_merged = AllocateSeqOneByteString(merged_length);
+      CopyStringCharacters(tail, var_merged.value(), IntPtrConstant(0),
+                           IntPtrConstant(0), word_tail_length,
+                           String::ONE_BYTE_ENCODING,
+                           String::ONE_BYTE_ENCODING);
+      CopyStringCharacters(right, var_merged.value(), IntPtrConstant(0),
+                           word_tail_length, word_right_length,
+                           String::ONE_BYTE_ENCODING,
+                           String::ONE_BYTE_ENCODING);
+      Goto(&merged);
+
+      BIND(&two_byte);
+      var_merged = AllocateSeqTwoByteString(merged_length);
+      CopyStringCharacters(tail, var_merged.value(), IntPtrConstant(0),
+                           IntPtrConstant(0), word_tail_length,
+                           String::TWO_BYTE_ENCODING,
+                           String::TWO_BYTE_ENCODING);
+      CopyStringCharacters(right, var_merged.value(), IntPtrConstant(0),
+                           word_tail_length, word_right_length,
+                           String::TWO_BYTE_ENCODING,
+                           String::TWO_BYTE_ENCODING);
+      Goto(&merged);
+
+      BIND(&merged);
+      TNode<String> head =
+          LoadObjectField<String>(left_cons, ConsString::kFirstOffset);
+      result = AllocateConsString(new_length, head, var_merged.value());
+      Goto(&done_native);
+    }
+
+    BIND(&allocate_cons);
     result =
         AllocateConsString(new_length, var_left.value(), var_right.value());
     Goto(&done_native);
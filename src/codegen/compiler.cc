@@ -39,6 +39,7 @@
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
 #include "src/init/bootstrapper.h"
+#include "src/interpreter/bytecode-array-accessor.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/log-inl.h"
 #include "src/objects/feedback-cell-inl.h"
@@ -421,6 +422,14 @@ void OptimizedCompilationJob::RecordCompilationStats(CompilationMode mode,
           static_cast<int>(time_background.InMicroseconds()));
       counters->turbofan_optimize_total_foreground()->AddSample(
           static_cast<int>(time_foreground.InMicroseconds()));
+      // The turbofan_* counters above cover all optimizing tiers; record the
+      // mid-tier separately so the two can be told apart.
+      if (compilation_info()->IsTurboprop()) {
+        counters->turboprop_optimize_total_time()->AddSample(
+            static_cast<int>(ElapsedTime().InMicroseconds()));
+        counters->turboprop_optimize_total_background()->AddSample(
+            static_cast<int>(time_background.InMicroseconds()));
+      }
     }
     counters->turbofan_ticks()->AddSample(static_cast<int>(
         compilation_info()->tick_counter().CurrentTicks() / 1000));
@@ -992,7 +1001,10 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
     PrintF(" for concurrent optimization.\n");
   }
 
-  if (CodeKindIsStoredInOptimizedCodeCache(code_kind)) {
+  // OSR jobs don't produce code for the function itself, so they must not
+  // block regular tier-up.
+  if (CodeKindIsStoredInOptimizedCodeCache(code_kind) &&
+      !compilation_info->is_osr()) {
     function->SetOptimizationMarker(OptimizationMarker::kInOptimizationQueue);
   }
 
@@ -1082,8 +1094,10 @@ MaybeHandle<Code> GetOptimizedCode(
     }
   }
 
-  // Reset profiler ticks, function is no longer considered hot.
+  // Reset profiler ticks, function is no longer considered hot. Remember how
+  // hot it was to prioritize the concurrent job.
   DCHECK(shared->is_compiled());
+  int profiler_ticks = function->feedback_vector().profiler_ticks();
   function->feedback_vector().set_profiler_ticks(0);
 
   // Check the compilation cache (stored on the Isolate, shared between native
@@ -1116,12 +1130,15 @@ MaybeHandle<Code> GetOptimizedCode(
   std::unique_ptr<OptimizedCompilationJob> job(
       compiler::Pipeline::NewCompilationJob(isolate, function, code_kind,
                                             has_script, osr_offset, osr_frame));
+  job->set_priority(profiler_ticks);
   OptimizedCompilationInfo* compilation_info = job->compilation_info();
 
   // Prepare the job and launch concurrent compilation, or compile now.
   if (mode == ConcurrencyMode::kConcurrent) {
     if (GetOptimizedCodeLater(std::move(job), isolate, compilation_info,
                               code_kind, function)) {
+      // Concurrent OSR continues in the interpreter.
+      if (!osr_offset.IsNone()) return {};
       return ContinuationForConcurrentOptimization(isolate, function);
     }
   } else {
@@ -2472,6 +2489,9 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnMainThread(
     v8::Extension* extension, Isolate* isolate,
     IsCompiledScope* is_compiled_scope) {
   UnoptimizedCompileState compile_state(isolate);
+  if (flags.post_parallel_compile_tasks()) {
+    compile_state.EnableParallelTasks(isolate->compiler_dispatcher());
+  }
   ParseInfo parse_info(isolate, flags, &compile_state);
   parse_info.set_extension(extension);
 
@@ -2629,7 +2649,8 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   ScriptCompileTimerScope compile_timer(isolate, no_cache_reason);
 
   if (compile_options == ScriptCompiler::kNoCompileOptions ||
-      compile_options == ScriptCompiler::kEagerCompile) {
+      compile_options == ScriptCompiler::kEagerCompile ||
+      compile_options == ScriptCompiler::kParallelCompile) {
     DCHECK_NULL(cached_data);
   } else {
     DCHECK(compile_options == ScriptCompiler::kConsumeCodeCache);
@@ -2708,6 +2729,10 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
                                         : ScriptType::kClassic);
 
       flags.set_is_eager(compile_options == ScriptCompiler::kEagerCompile);
+      if (compile_options == ScriptCompiler::kParallelCompile &&
+          !FLAG_single_threaded) {
+        flags.set_post_parallel_compile_tasks(true);
+      }
 
       maybe_result = CompileScriptOnMainThread(
           flags, source, script_details, origin_options, natives, extension,
@@ -3008,6 +3033,17 @@ MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
                                                    JavaScriptFrame* osr_frame) {
   DCHECK(!osr_offset.IsNone());
   DCHECK_NOT_NULL(osr_frame);
+  Isolate* isolate = function->GetIsolate();
+  if (FLAG_concurrent_osr && isolate->concurrent_recompilation_enabled()) {
+    // Don't queue the same loop twice. The job does not keep {osr_frame},
+    // which is gone by the time it runs.
+    if (isolate->optimizing_compile_dispatcher()->HasPendingOSRJob(
+            function, osr_offset)) {
+      return {};
+    }
+    return GetOptimizedCode(function, ConcurrencyMode::kConcurrent,
+                            CodeKindForOSR(), osr_offset);
+  }
   return GetOptimizedCode(function, ConcurrencyMode::kNotConcurrent,
                           CodeKindForOSR(), osr_offset, osr_frame);
 }
@@ -3029,8 +3065,9 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
   Handle<SharedFunctionInfo> shared = compilation_info->shared_info();
 
   CodeKind code_kind = compilation_info->code_kind();
+  const bool is_osr = compilation_info->is_osr();
   const bool should_install_code_on_function =
-      !CodeKindIsNativeContextIndependentJSFunction(code_kind);
+      !CodeKindIsNativeContextIndependentJSFunction(code_kind) && !is_osr;
   if (should_install_code_on_function) {
     // Reset profiler ticks, function is no longer considered hot.
     compilation_info->closure()->feedback_vector().set_profiler_ticks(0);
@@ -3057,12 +3094,29 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
       if (should_install_code_on_function) {
         compilation_info->closure()->set_code(*compilation_info->code());
       }
+      if (is_osr) {
+        // Re-arm the back edge of the loop the code was compiled for. Taking
+        // it enters the runtime, which finds the code in the OSR code cache.
+        // Back edges are armed by loop depth, so this arms the same back
+        // edges as when the code was requested, but no deeper ones.
+        Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(isolate),
+                                       isolate);
+        interpreter::BytecodeArrayAccessor accessor(
+            bytecode, compilation_info->osr_offset().ToInt());
+        DCHECK_EQ(accessor.current_bytecode(),
+                  interpreter::Bytecode::kJumpLoop);
+        int loop_depth = accessor.GetImmediateOperand(1);
+        if (bytecode->osr_loop_nesting_level() <= loop_depth) {
+          bytecode->set_osr_loop_nesting_level(loop_depth + 1);
+        }
+      }
       return CompilationJob::SUCCEEDED;
     }
   }
 
   DCHECK_EQ(job->state(), CompilationJob::State::kFailed);
   CompilerTracer::TraceAbortedJob(isolate, compilation_info);
+  if (is_osr) return CompilationJob::FAILED;
   compilation_info->closure()->set_code(shared->GetCode());
   // Clear the InOptimizationQueue marker, if it exists.
   if (!CodeKindIsNativeContextIndependentJSFunction(code_kind) &&
@@ -191,6 +191,9 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   // instead of generating JIT code for a function at all.
 
   // Generate and return optimized code for OSR, or empty handle on failure.
+  // With --concurrent-osr, a cache miss queues a background job (unless one is
+  // already pending for the loop) and returns an empty handle; the loop's back
+  // edge is re-armed once the code is installed in the OSR code cache.
   V8_WARN_UNUSED_RESULT static MaybeHandle<Code> GetOptimizedCodeForOSR(
       Handle<JSFunction> function, BytecodeOffset osr_offset,
       JavaScriptFrame* osr_frame);
@@ -357,6 +360,11 @@ class OptimizedCompilationJob : public CompilationJob {
     return compilation_info_;
   }
 
+  // The profiler ticks of the closure when it was marked for optimization.
+  // Concurrent jobs of hotter functions are compiled first.
+  int priority() const { return priority_; }
+  void set_priority(int priority) { priority_ = priority; }
+
  protected:
   // Overridden by the actual implementation.
   virtual Status PrepareJobImpl(Isolate* isolate) = 0;
@@ -370,6 +378,7 @@ class OptimizedCompilationJob : public CompilationJob {
   base::TimeDelta time_taken_to_execute_;
   base::TimeDelta time_taken_to_finalize_;
   const char* compiler_name_;
+  int priority_ = 0;
 };
 
 class FinalizeUnoptimizedCompilationData {
@@ -48,18 +48,14 @@ const char* const
         ACCESSOR_INFO_LIST_GENERATOR(ADD_ACCESSOR_INFO_NAME, /* not used */)
         ACCESSOR_SETTER_LIST(ADD_ACCESSOR_SETTER_NAME)
         // Stub cache:
-        "Load StubCache::primary_->key",
-        "Load StubCache::primary_->value",
-        "Load StubCache::primary_->map",
-        "Load StubCache::secondary_->key",
-        "Load StubCache::secondary_->value",
-        "Load StubCache::secondary_->map",
-        "Store StubCache::primary_->key",
-        "Store StubCache::primary_->value",
-        "Store StubCache::primary_->map",
-        "Store StubCache::secondary_->key",
-        "Store StubCache::secondary_->value",
-        "Store StubCache::secondary_->map",
+        "Load StubCache::primary_",
+        "Load StubCache::primary_mask_",
+        "Load StubCache::secondary_",
+        "Load StubCache::secondary_mask_",
+        "Store StubCache::primary_",
+        "Store StubCache::primary_mask_",
+        "Store StubCache::secondary_",
+        "Store StubCache::secondary_mask_",
         // Native code counters:
         STATS_COUNTER_NATIVE_CODE_LIST(ADD_STATS_COUNTER_NAME)
 };
@@ -217,23 +213,20 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
   StubCache* load_stub_cache = isolate->load_stub_cache();
 
   // Stub cache tables
-  Add(load_stub_cache->key_reference(StubCache::kPrimary).address(), index);
-  Add(load_stub_cache->value_reference(StubCache::kPrimary).address(), index);
-  Add(load_stub_cache->map_reference(StubCache::kPrimary).address(), index);
-  Add(load_stub_cache->key_reference(StubCache::kSecondary).address(), index);
-  Add(load_stub_cache->value_reference(StubCache::kSecondary).address(), index);
-  Add(load_stub_cache->map_reference(StubCache::kSecondary).address(), index);
+  Add(load_stub_cache->table_reference(StubCache::kPrimary).address(), index);
+  Add(load_stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+  Add(load_stub_cache->table_reference(StubCache::kSecondary).address(), index);
+  Add(load_stub_cache->mask_reference(StubCache::kSecondary).address(), index);
 
   StubCache* store_stub_cache = isolate->store_stub_cache();
 
   // Stub cache tables
-  Add(store_stub_cache->key_reference(StubCache::kPrimary).address(), index);
-  Add(store_stub_cache->value_reference(StubCache::kPrimary).address(), index);
-  Add(store_stub_cache->map_reference(StubCache::kPrimary).address(), index);
-  Add(store_stub_cache->key_reference(StubCache::kSecondary).address(), index);
-  Add(store_stub_cache->value_reference(StubCache::kSecondary).address(),
+  Add(store_stub_cache->table_reference(StubCache::kPrimary).address(), index);
+  Add(store_stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+  Add(store_stub_cache->table_reference(StubCache::kSecondary).address(),
+      index);
+  Add(store_stub_cache->mask_reference(StubCache::kSecondary).address(),
       index);
-  Add(store_stub_cache->map_reference(StubCache::kSecondary).address(), index);
 
   CHECK_EQ(kSpecialReferenceCount + kExternalReferenceCount +
                kBuiltinsReferenceCount + kRuntimeReferenceCount +
@@ -713,6 +713,9 @@ FUNCTION_REFERENCE_WITH_ISOLATE(re_grow_stack,
 FUNCTION_REFERENCE(re_match_for_call_from_js,
                    IrregexpInterpreter::MatchForCallFromJs)
 
+FUNCTION_REFERENCE(re_skip_until_one_byte_character,
+                   NativeRegExpMacroAssembler::SkipUntilOneByteCharacter)
+
 FUNCTION_REFERENCE(re_experimental_match_for_call_from_js,
                    ExperimentalRegExp::MatchForCallFromJs)
 
@@ -270,6 +270,8 @@ class StatsCounter;
   V(js_finalization_registry_remove_cell_from_unregister_token_map,            \
     "JSFinalizationRegistry::RemoveCellFromUnregisterTokenMap")                \
   V(re_match_for_call_from_js, "IrregexpInterpreter::MatchForCallFromJs")      \
+  V(re_skip_until_one_byte_character,                                          \
+    "NativeRegExpMacroAssembler::SkipUntilOneByteCharacter")                   \
   V(re_experimental_match_for_call_from_js,                                    \
     "ExperimentalRegExp::MatchForCallFromJs")                                  \
   EXTERNAL_REFERENCE_LIST_INTL(V)                                              \
@@ -2195,6 +2195,54 @@ void TurboAssembler::I64x2UConvertI32x4High(XMMRegister dst, XMMRegister src) {
   }
 }
 
+// There is no psraq before AVX-512, so use logical shifts instead:
+//   x >> n == ((x ^ 2^63) >>> n) - (2^63 >>> n)
+// Flipping the sign bit biases x into an unsigned number, and subtracting the
+// shifted bias sign-extends the result again.
+void TurboAssembler::I64x2ShrS(XMMRegister dst, XMMRegister src,
+                               uint8_t shift) {
+  DCHECK_NE(dst, kScratchDoubleReg);
+  DCHECK_NE(src, kScratchDoubleReg);
+  shift &= 0x3F;
+  Pcmpeqd(kScratchDoubleReg, kScratchDoubleReg);
+  Psllq(kScratchDoubleReg, byte{63});
+  if (CpuFeatures::IsSupported(AVX)) {
+    CpuFeatureScope avx_scope(this, AVX);
+    vpxor(dst, src, kScratchDoubleReg);
+  } else {
+    if (dst != src) movaps(dst, src);
+    pxor(dst, kScratchDoubleReg);
+  }
+  Psrlq(dst, shift);
+  Psrlq(kScratchDoubleReg, shift);
+  Psubq(dst, kScratchDoubleReg);
+}
+
+void TurboAssembler::I64x2ShrS(XMMRegister dst, XMMRegister src,
+                               Register shift, XMMRegister xmm_shift,
+                               Register tmp_shift) {
+  DCHECK_NE(dst, kScratchDoubleReg);
+  DCHECK_NE(src, kScratchDoubleReg);
+  DCHECK_NE(xmm_shift, kScratchDoubleReg);
+  DCHECK_NE(dst, xmm_shift);
+  DCHECK_NE(src, xmm_shift);
+  movl(tmp_shift, shift);
+  andl(tmp_shift, Immediate(0x3F));
+  Movq(xmm_shift, tmp_shift);
+  Pcmpeqd(kScratchDoubleReg, kScratchDoubleReg);
+  Psllq(kScratchDoubleReg, byte{63});
+  if (CpuFeatures::IsSupported(AVX)) {
+    CpuFeatureScope avx_scope(this, AVX);
+    vpxor(dst, src, kScratchDoubleReg);
+  } else {
+    if (dst != src) movaps(dst, src);
+    pxor(dst, kScratchDoubleReg);
+  }
+  Psrlq(dst, xmm_shift);
+  Psrlq(kScratchDoubleReg, xmm_shift);
+  Psubq(dst, kScratchDoubleReg);
+}
+
 // 1. Unpack src0, src0 into even-number elements of scratch.
 // 2. Unpack src1, src1 into even-number elements of dst.
 // 3. Multiply 1. with 2.
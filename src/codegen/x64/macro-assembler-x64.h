@@ -590,6 +590,13 @@ class V8_EXPORT_PRIVATE TurboAssembler : public TurboAssemblerBase {
   void I32x4UConvertI16x8High(XMMRegister dst, XMMRegister src);
   void I64x2SConvertI32x4High(XMMRegister dst, XMMRegister src);
   void I64x2UConvertI32x4High(XMMRegister dst, XMMRegister src);
+  // Both versions clobber kScratchDoubleReg. The shift count is taken modulo
+  // 64; {tmp_shift} may alias {shift}.
+  // TODO(v8): Use vpsraq here, and vpopcntb for i8x16.popcnt, once CpuFeatures
+  // detects AVX-512VL and AVX-512 BITALG.
+  void I64x2ShrS(XMMRegister dst, XMMRegister src, uint8_t shift);
+  void I64x2ShrS(XMMRegister dst, XMMRegister src, Register shift,
+                 XMMRegister xmm_shift, Register tmp_shift);
 
   // Requires dst == mask when AVX is not supported.
   void S128Select(XMMRegister dst, XMMRegister mask, XMMRegister src1,
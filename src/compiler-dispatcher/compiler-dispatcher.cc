@@ -62,8 +62,6 @@ base::Optional<CompilerDispatcher::JobId> CompilerDispatcher::Enqueue(
   RuntimeCallTimerScope runtimeTimer(
       isolate_, RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
 
-  if (!IsEnabled()) return base::nullopt;
-
   std::unique_ptr<Job> job = std::make_unique<Job>(new BackgroundCompileTask(
       outer_parse_info, function_name, function_literal,
       worker_thread_runtime_call_stats_, background_compile_timer_,
@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -25,7 +27,8 @@ namespace {
 
 void DisposeCompilationJob(OptimizedCompilationJob* job,
                            bool restore_function_code) {
-  if (restore_function_code) {
+  // OSR jobs never installed anything on the function.
+  if (restore_function_code && !job->compilation_info()->is_osr()) {
     Handle<JSFunction> function = job->compilation_info()->closure();
     function->set_code(function->shared().GetCode());
     if (function->IsInOptimizationQueue()) {
@@ -104,23 +107,29 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
     DCHECK_EQ(0, ref_count_);
   }
 #endif
-  DCHECK_EQ(0, input_queue_length_);
-  DeleteArray(input_queue_);
+  DCHECK(input_queue_.empty());
 }
 
 OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate, bool check_if_flushing) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  if (input_queue_.empty()) return nullptr;
+  // Pick the hottest job; among equally hot jobs the oldest one wins.
+  auto next = input_queue_.begin();
+  for (auto it = next + 1; it != input_queue_.end(); ++it) {
+    if (it->priority > next->priority) next = it;
+  }
+  OptimizedCompilationJob* job = next->job;
   DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
+  isolate_->counters()->turbofan_optimize_queue_latency()->AddTimedSample(
+      base::TimeTicks::Now() - next->queued_at);
+  input_queue_.erase(next);
   if (check_if_flushing) {
     if (mode_ == FLUSH) {
       UnparkedScope scope(local_isolate->heap());
       local_isolate->heap()->AttachPersistentHandles(
           job->compilation_info()->DetachPersistentHandles());
+      RemovePendingOSRJob(job);
       DisposeCompilationJob(job, true);
       local_isolate->heap()->DetachPersistentHandles();
       return nullptr;
@@ -159,6 +168,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
       output_queue_.pop();
     }
 
+    RemovePendingOSRJob(job);
     DisposeCompilationJob(job, restore_function_code);
   }
 }
@@ -167,13 +177,12 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
   if (blocking_behavior == BlockingBehavior::kDontBlock) {
     if (FLAG_block_concurrent_recompilation) Unblock();
     base::MutexGuard access_input_queue_(&input_queue_mutex_);
-    while (input_queue_length_ > 0) {
-      OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-      DCHECK_NOT_NULL(job);
-      input_queue_shift_ = InputQueueIndex(1);
-      input_queue_length_--;
-      DisposeCompilationJob(job, true);
+    for (const InputQueueEntry& entry : input_queue_) {
+      DCHECK_NOT_NULL(entry.job);
+      RemovePendingOSRJob(entry.job);
+      DisposeCompilationJob(entry.job, true);
     }
+    input_queue_.clear();
     FlushOutputQueue(true);
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Flushed concurrent recompilation queues (not blocking).\n");
@@ -203,8 +212,8 @@ void OptimizingCompileDispatcher::Stop() {
   }
 
   // At this point the optimizing compiler thread's event loop has stopped.
-  // There is no need for a mutex when reading input_queue_length_.
-  DCHECK_EQ(input_queue_length_, 0);
+  // There is no need for a mutex when reading input_queue_.
+  DCHECK(input_queue_.empty());
   FlushOutputQueue(false);
 }
 
@@ -219,9 +228,18 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
       job = output_queue_.front();
       output_queue_.pop();
     }
+    RemovePendingOSRJob(job);
     OptimizedCompilationInfo* info = job->compilation_info();
     Handle<JSFunction> function(*info->closure(), isolate_);
-    if (function->HasAvailableCodeKind(info->code_kind())) {
+    bool already_optimized =
+        info->is_osr()
+            ? !function->native_context()
+                   .GetOSROptimizedCodeCache()
+                   .GetOptimizedCode(info->shared_info(), info->osr_offset(),
+                                     isolate_)
+                   .is_null()
+            : function->HasAvailableCodeKind(info->code_kind());
+    if (already_optimized) {
       if (FLAG_trace_concurrent_recompilation) {
         PrintF("  ** Aborting compilation for ");
         function->ShortPrint();
@@ -240,9 +258,12 @@ void OptimizingCompileDispatcher::QueueForOptimization(
   {
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
-    input_queue_length_++;
+    DCHECK_LT(static_cast<int>(input_queue_.size()), input_queue_capacity_);
+    input_queue_.push_back({job, job->priority(), base::TimeTicks::Now()});
+  }
+  if (job->compilation_info()->is_osr()) {
+    base::MutexGuard access_pending_osr_jobs(&pending_osr_jobs_mutex_);
+    pending_osr_jobs_.push_back(job);
   }
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
@@ -252,6 +273,31 @@ void OptimizingCompileDispatcher::QueueForOptimization(
   }
 }
 
+bool OptimizingCompileDispatcher::HasPendingOSRJob(
+    Handle<JSFunction> function, BytecodeOffset osr_offset) {
+  base::MutexGuard access_pending_osr_jobs(&pending_osr_jobs_mutex_);
+  for (OptimizedCompilationJob* job : pending_osr_jobs_) {
+    OptimizedCompilationInfo* info = job->compilation_info();
+    // The OSR code cache is per native context.
+    if (*info->shared_info() != function->shared() ||
+        info->closure()->native_context() != function->native_context()) {
+      continue;
+    }
+    if (osr_offset.IsNone() || info->osr_offset() == osr_offset) return true;
+  }
+  return false;
+}
+
+void OptimizingCompileDispatcher::RemovePendingOSRJob(
+    OptimizedCompilationJob* job) {
+  if (!job->compilation_info()->is_osr()) return;
+  base::MutexGuard access_pending_osr_jobs(&pending_osr_jobs_mutex_);
+  auto it =
+      std::find(pending_osr_jobs_.begin(), pending_osr_jobs_.end(), job);
+  DCHECK(it != pending_osr_jobs_.end());
+  pending_osr_jobs_.erase(it);
+}
+
 void OptimizingCompileDispatcher::Unblock() {
   while (blocked_jobs_ > 0) {
     V8::GetCurrentPlatform()->CallOnWorkerThread(
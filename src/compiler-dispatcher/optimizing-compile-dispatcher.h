@@ -7,17 +7,23 @@
 
 #include <atomic>
 #include <queue>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
+#include "src/handles/handles.h"
 #include "src/utils/allocation.h"
+#include "src/utils/utils.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
 namespace internal {
 
+class JSFunction;
 class LocalHeap;
 class OptimizedCompilationJob;
 class RuntimeCallStats;
@@ -28,13 +34,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   explicit OptimizingCompileDispatcher(Isolate* isolate)
       : isolate_(isolate),
         input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
-        input_queue_length_(0),
-        input_queue_shift_(0),
         mode_(COMPILE),
         blocked_jobs_(0),
         ref_count_(0),
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+    input_queue_.reserve(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -46,46 +50,63 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void Unblock();
   void InstallOptimizedFunctions();
 
+  // Returns true if an OSR job for {function}'s code in its native context at
+  // {osr_offset} (or at any offset, if {osr_offset} is none) has been queued
+  // and not yet been installed or disposed. Main thread only.
+  bool HasPendingOSRJob(Handle<JSFunction> function,
+                        BytecodeOffset osr_offset = BytecodeOffset::None());
+
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
+    return static_cast<int>(input_queue_.size()) < input_queue_capacity_;
   }
 
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
  private:
+  FRIEND_TEST(OptimizingCompileDispatcherTest, HotFunctionsFirst);
+  FRIEND_TEST(OptimizingCompileDispatcherTest, PriorityFromProfilerTicks);
+
   class CompileTask;
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct InputQueueEntry {
+    OptimizedCompilationJob* job;
+    // See OptimizedCompilationJob::priority(). Hotter functions are compiled
+    // first.
+    int priority;
+    base::TimeTicks queued_at;
+  };
+
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(OptimizedCompilationJob* job, RuntimeCallStats* stats,
                    LocalIsolate* local_isolate);
   OptimizedCompilationJob* NextInput(LocalIsolate* local_isolate,
                                      bool check_if_flushing = false);
-
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
+  // Called before {job} is finalized or disposed.
+  void RemovePendingOSRJob(OptimizedCompilationJob* job);
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  // Incoming recompilation tasks, in the order they were queued. The queue is
+  // bounded by --concurrent-recompilation-queue-length (a handful of entries),
+  // so NextInput simply scans it for the highest priority entry.
+  std::vector<InputQueueEntry> input_queue_;
   int input_queue_capacity_;
-  int input_queue_length_;
-  int input_queue_shift_;
   base::Mutex input_queue_mutex_;
 
-  // Queue of recompilation tasks ready to be installed (excluding OSR).
+  // Queue of recompilation tasks ready to be installed.
   std::queue<OptimizedCompilationJob*> output_queue_;
   // Used for job based recompilation which has multiple producers on
   // different threads.
   base::Mutex output_queue_mutex_;
 
+  // OSR jobs anywhere between QueueForOptimization and their installation.
+  // Jobs may be disposed on a background thread when flushing.
+  std::vector<OptimizedCompilationJob*> pending_osr_jobs_;
+  base::Mutex pending_osr_jobs_mutex_;
+
   std::atomic<ModeFlag> mode_;
 
   int blocked_jobs_;
@@ -89,6 +89,10 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
   if (m.IsPhi()) {
     int const value_input_count = m.node()->op()->ValueInputCount();
     if (value_input_count > functions_size) {
+      TRACE("Not considering call site #"
+            << node->id() << ":" << node->op()->mnemonic()
+            << ", because it has " << value_input_count
+            << " targets (limit " << functions_size << ")");
       out.num_functions = 0;
       return out;
     }
@@ -147,6 +151,10 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   if (!IrOpcode::IsInlineeOpcode(node->opcode())) return NoChange();
 
   if (total_inlined_bytecode_size_ >= FLAG_max_inlined_bytecode_size_absolute) {
+    TRACE("Not considering call site #"
+          << node->id() << ":" << node->op()->mnemonic()
+          << ", because the absolute inlining budget is used up ("
+          << total_inlined_bytecode_size_ << " bytes inlined)");
     return NoChange();
   }
 
@@ -155,7 +163,10 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   seen_.insert(node->id());
 
   // Check if the {node} is an appropriate candidate for inlining.
-  Candidate candidate = CollectFunctions(node, kMaxCallPolymorphism);
+  int const max_targets =
+      std::max(1, std::min(FLAG_max_polymorphic_inlining_targets,
+                           kMaxCallPolymorphism));
+  Candidate candidate = CollectFunctions(node, max_targets);
   if (candidate.num_functions == 0) {
     return NoChange();
   } else if (candidate.num_functions > 1 && !FLAG_polymorphic_inlining) {
@@ -229,6 +240,10 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   // invocations of the caller.
   if (candidate.frequency.IsKnown() &&
       candidate.frequency.value() < FLAG_min_inlining_frequency) {
+    TRACE("Not considering call site #"
+          << node->id() << ":" << node->op()->mnemonic()
+          << ", because its frequency " << candidate.frequency
+          << " is below the threshold " << FLAG_min_inlining_frequency);
     return NoChange();
   }
 
@@ -269,6 +284,12 @@ void JSInliningHeuristic::Finalize() {
     int total_size =
         total_inlined_bytecode_size_ + static_cast<int>(size_of_candidate);
     if (total_size > FLAG_max_inlined_bytecode_size_cumulative) {
+      TRACE("Not inlining call site #"
+            << candidate.node->id() << ":" << candidate.node->op()->mnemonic()
+            << " of scaled size " << static_cast<int>(size_of_candidate)
+            << ", because it would exceed the cumulative budget ("
+            << total_size << " > "
+            << FLAG_max_inlined_bytecode_size_cumulative << ")");
       // Try if any smaller functions are available to inline.
       continue;
     }
@@ -770,6 +791,10 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
     return true;
   } else if (left.frequency.value() < right.frequency.value()) {
     return false;
+  } else if (left.total_size != right.total_size) {
+    // Among equally frequent call sites prefer the cheaper one, so that the
+    // cumulative budget is spread over more call sites.
+    return left.total_size < right.total_size;
   } else {
     return left.node->id() > right.node->id();
   }
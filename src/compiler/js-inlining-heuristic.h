@@ -41,9 +41,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
   }
 
  private:
-  // This limit currently matches what the old compiler did. We may want to
-  // re-evaluate and come up with a proper limit for TurboFan.
-  static const int kMaxCallPolymorphism = 4;
+  // Upper bound for --max-polymorphic-inlining-targets, which sizes the
+  // per-candidate arrays below.
+  static const int kMaxCallPolymorphism = 8;
 
   struct Candidate {
     base::Optional<JSFunctionRef> functions[kMaxCallPolymorphism];
@@ -3811,6 +3811,32 @@ Node* WasmGraphBuilder::CheckBoundsAndAlignment(
   return index;
 }
 
+// Check whether the last explicit bounds check emitted by {BoundsCheckMem}
+// already covers an access to {index} that ends at {end_offset}.
+bool WasmGraphBuilder::IsBoundsCheckRedundant(Node* index,
+                                              uintptr_t end_offset) {
+  const CheckedMemoryAccess& last = last_bounds_check_;
+  if (last.check == nullptr || last.index != index) return false;
+  if (last.end_offset < end_offset) return false;
+  // A memory.grow (or any call) reloads the memory size, so the cached check
+  // only applies while the same size node is in use.
+  if (last.mem_size != instance_cache_->mem_size) return false;
+  // Only trap nodes may sit between the previous check and the current
+  // control; any merge, branch or call ends the straight-line sequence. Bound
+  // the walk so that long trap chains stay linear.
+  static constexpr int kMaxTrapChainLength = 16;
+  Node* current = control();
+  for (int i = 0; i < kMaxTrapChainLength; ++i) {
+    if (current == last.check) return true;
+    IrOpcode::Value opcode = current->opcode();
+    if (opcode != IrOpcode::kTrapIf && opcode != IrOpcode::kTrapUnless) {
+      return false;
+    }
+    current = NodeProperties::GetControlInput(current);
+  }
+  return false;
+}
+
 // Insert code to bounds check a memory access if necessary. Return the
 // bounds-checked index, which is guaranteed to have (the equivalent of)
 // {uintptr_t} representation.
@@ -3819,6 +3845,7 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
                                        wasm::WasmCodePosition position,
                                        EnforceBoundsCheck enforce_check) {
   DCHECK_LE(1, access_size);
+  Node* const original_index = index;
   if (!env_->module->is_memory64) index = Uint32ToUintptr(index);
   if (!FLAG_wasm_bounds_checks) return index;
 
@@ -3857,7 +3884,18 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   //    - computing {effective_size} as {mem_size - end_offset} and
   //    - checking that {index < effective_size}.
 
+  if (IsBoundsCheckRedundant(original_index, end_offset)) {
+    return last_bounds_check_.result;
+  }
+
   Node* mem_size = instance_cache_->mem_size;
+  if (env_->min_memory_size == env_->max_memory_size) {
+    // The memory cannot grow, so its size is a constant. This also makes the
+    // check below loop-invariant apart from the index. Note that
+    // {end_offset < max_memory_size} was checked above.
+    DCHECK_LT(end_offset, env_->min_memory_size);
+    mem_size = mcgraph_->UintPtrConstant(env_->min_memory_size);
+  }
   if (end_offset > env_->min_memory_size) {
     // The end offset is larger than the smallest memory.
     // Dynamically check the end offset against the dynamic memory size.
@@ -3882,7 +3920,7 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
 
   // Introduce the actual bounds check.
   Node* cond = gasm_->UintLessThan(index, effective_size);
-  TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+  Node* check = TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
 
   if (untrusted_code_mitigations_) {
     // In the fallthrough case, condition the index with the memory mask.
@@ -3890,6 +3928,12 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
     DCHECK_NOT_NULL(mem_mask);
     index = gasm_->WordAnd(index, mem_mask);
   }
+
+  last_bounds_check_.index = original_index;
+  last_bounds_check_.mem_size = instance_cache_->mem_size;
+  last_bounds_check_.check = check;
+  last_bounds_check_.result = index;
+  last_bounds_check_.end_offset = end_offset;
   return index;
 }
 
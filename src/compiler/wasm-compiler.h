@@ -507,6 +507,10 @@ class WasmGraphBuilder {
   // BoundsCheckMem receives a uint32 {index} node and returns a ptrsize index.
   Node* BoundsCheckMem(uint8_t access_size, Node* index, uint64_t offset,
                        wasm::WasmCodePosition, EnforceBoundsCheck);
+  // Returns true if a previous bounds check of {index} covering at least
+  // {end_offset} against the current memory size dominates the current
+  // control, i.e. it is reachable by only walking through trap nodes.
+  bool IsBoundsCheckRedundant(Node* index, uintptr_t end_offset);
 
   Node* CheckBoundsAndAlignment(int8_t access_size, Node* index,
                                 uint64_t offset, wasm::WasmCodePosition);
@@ -712,6 +716,18 @@ class WasmGraphBuilder {
 
   WasmInstanceCacheNodes* instance_cache_ = nullptr;
 
+  // The last explicit bounds check emitted by {BoundsCheckMem}. Used to elide
+  // repeated checks of the same index within a straight-line sequence of
+  // memory accesses when the trap handler is not available.
+  struct CheckedMemoryAccess {
+    Node* index = nullptr;       // The original (unconverted) index node.
+    Node* mem_size = nullptr;    // The memory size the check was against.
+    Node* check = nullptr;       // The TrapUnless node of the check.
+    Node* result = nullptr;      // The bounds-checked ptrsize index.
+    uintptr_t end_offset = 0;    // The largest end offset that was checked.
+  };
+  CheckedMemoryAccess last_bounds_check_;
+
   SetOncePointer<Node> instance_node_;
   SetOncePointer<Node> globals_start_;
   SetOncePointer<Node> imported_mutable_globals_;
@@ -150,5 +150,81 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   return os;
 }
 
+static void WriteJSONString(std::ostream& os, const std::string& str) {
+  os << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buffer[8];
+      base::OS::SNPrintF(buffer, sizeof(buffer), "\\u%04x", c);
+      os << buffer;
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+static void WriteJSONStats(std::ostream& os,
+                           const CompilationStatistics::BasicStats& stats) {
+  const size_t kBufferSize = 256;
+  char buffer[kBufferSize];
+  base::OS::SNPrintF(buffer, kBufferSize,
+                     "\"time_ms\": %.3f, \"total_allocated_bytes\": %zu, "
+                     "\"max_allocated_bytes\": %zu, "
+                     "\"absolute_max_allocated_bytes\": %zu",
+                     stats.delta_.InMillisecondsF(),
+                     stats.total_allocated_bytes_, stats.max_allocated_bytes_,
+                     stats.absolute_max_allocated_bytes_);
+  os << buffer;
+}
+
+std::ostream& operator<<(std::ostream& os, const AsJSONStatistics& js) {
+  const CompilationStatistics& s = js.s;
+
+  std::vector<CompilationStatistics::PhaseKindMap::const_iterator>
+      sorted_phase_kinds(s.phase_kind_map_.size());
+  for (auto it = s.phase_kind_map_.begin(); it != s.phase_kind_map_.end();
+       ++it) {
+    sorted_phase_kinds[it->second.insert_order_] = it;
+  }
+  std::vector<CompilationStatistics::PhaseMap::const_iterator> sorted_phases(
+      s.phase_map_.size());
+  for (auto it = s.phase_map_.begin(); it != s.phase_map_.end(); ++it) {
+    sorted_phases[it->second.insert_order_] = it;
+  }
+
+  os << "{\"phase_kinds\": [";
+  bool first_kind = true;
+  for (const auto& phase_kind_it : sorted_phase_kinds) {
+    const auto& phase_kind_name = phase_kind_it->first;
+    if (!first_kind) os << ", ";
+    first_kind = false;
+    os << "{\"name\": ";
+    WriteJSONString(os, phase_kind_name);
+    os << ", ";
+    WriteJSONStats(os, phase_kind_it->second);
+    os << ", \"phases\": [";
+    bool first_phase = true;
+    for (const auto& phase_it : sorted_phases) {
+      const auto& phase_stats = phase_it->second;
+      if (phase_stats.phase_kind_name_ != phase_kind_name) continue;
+      if (!first_phase) os << ", ";
+      first_phase = false;
+      os << "{\"name\": ";
+      WriteJSONString(os, phase_it->first);
+      os << ", ";
+      WriteJSONStats(os, phase_stats);
+      os << "}";
+    }
+    os << "]}";
+  }
+  os << "], \"totals\": {";
+  WriteJSONStats(os, s.total_stats_);
+  os << "}}";
+  return os;
+}
+
 }  // namespace internal
 }  // namespace v8
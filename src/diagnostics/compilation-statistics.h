@@ -22,6 +22,13 @@ struct AsPrintableStatistics {
   const bool machine_output;
 };
 
+// Prints the statistics as a single JSON object with per-phase-kind and
+// per-phase wall time (ms) and zone allocation (bytes), for consumption by
+// benchmarking scripts.
+struct AsJSONStatistics {
+  const CompilationStatistics& s;
+};
+
 class CompilationStatistics final : public Malloced {
  public:
   CompilationStatistics() = default;
@@ -74,6 +81,7 @@ class CompilationStatistics final : public Malloced {
 
   friend std::ostream& operator<<(std::ostream& os,
                                   const AsPrintableStatistics& s);
+  friend std::ostream& operator<<(std::ostream& os, const AsJSONStatistics& s);
 
   using PhaseKindStats = OrderedStats;
   using PhaseKindMap = std::map<std::string, PhaseKindStats>;
@@ -86,6 +94,7 @@ class CompilationStatistics final : public Malloced {
 };
 
 std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& s);
+std::ostream& operator<<(std::ostream& os, const AsJSONStatistics& s);
 
 }  // namespace internal
 }  // namespace v8
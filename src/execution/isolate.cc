@@ -3818,7 +3818,7 @@ void Isolate::DumpAndResetStats() {
     }
   }
   if (turbo_statistics() != nullptr) {
-    DCHECK(FLAG_turbo_stats || FLAG_turbo_stats_nvp);
+    DCHECK(FLAG_turbo_stats || FLAG_turbo_stats_nvp || FLAG_turbo_stats_json);
     StdoutStream os;
     if (FLAG_turbo_stats) {
       AsPrintableStatistics ps = {*turbo_statistics(), false};
@@ -3828,6 +3828,9 @@ void Isolate::DumpAndResetStats() {
       AsPrintableStatistics ps = {*turbo_statistics(), true};
       os << ps << std::endl;
     }
+    if (FLAG_turbo_stats_json) {
+      os << AsJSONStatistics{*turbo_statistics()} << std::endl;
+    }
     delete turbo_statistics_;
     turbo_statistics_ = nullptr;
   }
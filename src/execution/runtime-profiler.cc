@@ -276,6 +276,9 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
       (bytecode.length() / kBytecodeSizeAllowancePerTick);
   if (FLAG_turboprop && !active_tier_is_turboprop) {
     DCHECK_EQ(function.NextTier(), CodeKind::TURBOPROP);
+    ticks_for_optimization =
+        FLAG_ticks_before_midtier_optimization +
+        (bytecode.length() / kBytecodeSizeAllowancePerTick);
     int global_ticks_diff =
         (current_global_ticks_ -
          function.feedback_vector()
@@ -286,7 +289,17 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
                  kMaxAdditionalMidTierGlobalTicks);
   }
   ticks_for_optimization *= scale_factor;
+  if (V8_UNLIKELY(FLAG_cache_hotness_hints) &&
+      function.shared().was_marked_hot()) {
+    // The function was hot in an earlier run (possibly in another process
+    // when the SFI came from the code cache). One tick is still required so
+    // that the feedback vector has seen at least some execution.
+    ticks_for_optimization = std::min(ticks_for_optimization, 1);
+  }
   if (ticks >= ticks_for_optimization) {
+    if (V8_UNLIKELY(FLAG_cache_hotness_hints)) {
+      function.shared().set_was_marked_hot(true);
+    }
     return OptimizationReason::kHotAndStable;
   } else if (ShouldOptimizeAsSmallFunction(bytecode.length(), ticks,
                                            any_ic_changed_,
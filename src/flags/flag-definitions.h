@@ -496,6 +496,10 @@ DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
 
 DEFINE_INT(interrupt_budget, 144 * KB,
            "interrupt budget which should be used for the profiler counter")
+DEFINE_BOOL(cache_hotness_hints, false,
+            "remember functions that were marked hot in their "
+            "SharedFunctionInfo (and hence in the code cache) and optimize "
+            "them after a single profiler tick")
 
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
@@ -568,6 +572,9 @@ DEFINE_UINT_READONLY(max_minimorphic_map_checks, 4,
 // The default of 10 is approximately the ration of TP to TF interrupt budget.
 DEFINE_INT(ticks_scale_factor_for_top_tier, 10,
            "scale factor for profiler ticks when tiering up from midtier")
+DEFINE_INT(ticks_before_midtier_optimization, 3,
+           "number of profiler ticks before a function is optimized with "
+           "turboprop (in addition to the bytecode size allowance)")
 
 // Flags for concurrent recompilation.
 DEFINE_BOOL(concurrent_recompilation, true,
@@ -662,6 +669,7 @@ DEFINE_BOOL_READONLY(fixed_array_bounds_checks, true,
 DEFINE_BOOL(turbo_stats, false, "print TurboFan statistics")
 DEFINE_BOOL(turbo_stats_nvp, false,
             "print TurboFan statistics in machine-readable format")
+DEFINE_BOOL(turbo_stats_json, false, "print TurboFan statistics as JSON")
 DEFINE_BOOL(turbo_stats_wasm, false,
             "print TurboFan statistics of wasm compilations")
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
@@ -685,6 +693,9 @@ DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "the compiler to hit (release) assertions")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
+DEFINE_INT(max_polymorphic_inlining_targets, 4,
+           "maximum number of targets of a polymorphic call site considered "
+           "for inlining (at most 8)")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
 DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size, 999999)
@@ -699,6 +710,9 @@ DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile OSR code on a background thread and keep running the "
+            "loop in the interpreter until it is ready")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
 DEFINE_BOOL(trace_environment_liveness, false,
@@ -755,6 +769,9 @@ DEFINE_BOOL(turbo_nci, false,
 // feedback collection is made unconditional.
 DEFINE_IMPLICATION(turbo_nci, turbo_collect_feedback_in_generic_lowering)
 DEFINE_BOOL(print_nci_code, false, "print native context independent code.")
+DEFINE_BOOL(serialize_nci_code, false,
+            "include native context independent code in the code cache.")
+DEFINE_IMPLICATION(serialize_nci_code, turbo_nci)
 DEFINE_BOOL(trace_turbo_nci, false, "trace native context independent code.")
 DEFINE_BOOL(turbo_collect_feedback_in_generic_lowering, true,
             "enable experimental feedback collection in generic lowering.")
@@ -908,6 +925,12 @@ DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
+DEFINE_BOOL(wasm_pgo_to_file, false,
+            "record the order in which wasm functions are lazily compiled and "
+            "write it to a profile file when the module dies")
+DEFINE_BOOL(wasm_pgo_from_file, false,
+            "read wasm profiles written by --wasm-pgo-to-file and compile the "
+            "recorded functions in the background")
 
 DEFINE_BOOL(wasm_grow_shared_memory, true,
             "allow growing shared WebAssembly memory objects")
@@ -1366,6 +1389,9 @@ DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
            "maximum number of valid maps to track in POLYMORPHIC state")
+DEFINE_BOOL(adaptive_stub_cache, true,
+            "grow the megamorphic stub cache when it is too small for the "
+            "accesses between two GCs")
 
 DEFINE_BOOL(native_code_counters, DEBUG_BOOL,
             "generate extra code for manipulating stats counters")
@@ -1492,6 +1518,9 @@ DEFINE_INT(regexp_tier_up_ticks, 1,
            "tiering-up to the compiler")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
+DEFINE_SIZE_T(regexp_shared_bytecode_cache_size, 4 * MB,
+              "maximum size in bytes of the regexp bytecode cache shared by "
+              "all isolates in the process (0 to disable)")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -1508,6 +1537,10 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+// TODO(v8): Enable by default once the DFA is cached across exec calls.
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, false,
+            "let the experimental regexp engine reject subjects without a "
+            "match using a lazily constructed DFA")
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
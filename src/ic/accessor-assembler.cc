@@ -2600,7 +2600,7 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kMapKeyShift))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
+  uint32_t mask = (StubCache::kMaxPrimaryTableSize - 1)
                   << StubCache::kCacheIndexShift;
   TNode<UintPtrT> result =
       ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
@@ -2615,7 +2615,7 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(
   TNode<Int32T> name32 = TruncateIntPtrToInt32(BitcastTaggedToWord(name));
   TNode<Int32T> hash = Int32Sub(TruncateIntPtrToInt32(seed), name32);
   hash = Int32Add(hash, Int32Constant(StubCache::kSecondaryMagic));
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
+  int32_t mask = (StubCache::kMaxSecondaryTableSize - 1)
                  << StubCache::kCacheIndexShift;
   TNode<UintPtrT> result =
       ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
@@ -2627,14 +2627,22 @@ void AccessorAssembler::TryProbeStubCacheTable(
     TNode<Object> name, TNode<Map> map, Label* if_handler,
     TVariable<MaybeObject>* var_handler, Label* if_miss) {
   StubCache::Table table = static_cast<StubCache::Table>(table_id);
+  // The {entry_offset} is computed for the maximum table size, mask it down
+  // to the current size of the table.
+  TNode<ExternalReference> mask_address = ExternalConstant(
+      ExternalReference::Create(stub_cache->mask_reference(table)));
+  TNode<Uint32T> mask = Load<Uint32T>(mask_address);
+  entry_offset = Signed(WordAnd(entry_offset, ChangeUint32ToWord(mask)));
+
   // The {table_offset} holds the entry offset times four (due to masking
   // and shifting optimizations).
   const int kMultiplier =
       sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
   entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
 
-  TNode<ExternalReference> key_base = ExternalConstant(
-      ExternalReference::Create(stub_cache->key_reference(table)));
+  TNode<ExternalReference> table_address = ExternalConstant(
+      ExternalReference::Create(stub_cache->table_reference(table)));
+  TNode<RawPtrT> key_base = Load<RawPtrT>(table_address);
 
   // Check that the key in the entry matches the name.
   DCHECK_EQ(0, offsetof(StubCache::Entry, key));
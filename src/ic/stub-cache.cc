@@ -4,8 +4,11 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
 #include "src/logging/counters.h"
@@ -18,6 +21,12 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  AllocateTables(kPrimaryTableSize, kSecondaryTableSize);
+}
+
+StubCache::~StubCache() {
+  delete[] primary_;
+  delete[] secondary_;
 }
 
 void StubCache::Initialize() {
@@ -26,6 +35,21 @@ void StubCache::Initialize() {
   Clear();
 }
 
+void StubCache::AllocateTables(int primary_size, int secondary_size) {
+  DCHECK(base::bits::IsPowerOfTwo(primary_size));
+  DCHECK(base::bits::IsPowerOfTwo(secondary_size));
+  DCHECK_LE(primary_size, kMaxPrimaryTableSize);
+  DCHECK_LE(secondary_size, kMaxSecondaryTableSize);
+  delete[] primary_;
+  delete[] secondary_;
+  primary_ = new Entry[primary_size];
+  secondary_ = new Entry[secondary_size];
+  primary_size_ = primary_size;
+  secondary_size_ = secondary_size;
+  primary_mask_ = (primary_size - 1) << kCacheIndexShift;
+  secondary_mask_ = (secondary_size - 1) << kCacheIndexShift;
+}
+
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
@@ -40,7 +64,7 @@ int StubCache::PrimaryOffset(Name name, Map map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kMapKeyShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & ((kMaxPrimaryTableSize - 1) << kCacheIndexShift);
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -50,7 +74,7 @@ int StubCache::SecondaryOffset(Name name, int seed) {
   // Use the seed from the primary cache in the secondary cache.
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t key = (seed - name_low32bits) + kSecondaryMagic;
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & ((kMaxSecondaryTableSize - 1) << kCacheIndexShift);
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -83,7 +107,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
 
   // Compute the primary entry.
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = primary_entry(primary_offset);
   MaybeObject old_handler(
       TaggedValue::ToMaybeObject(isolate(), primary->value));
   // If the primary entry has useful data in it, we retire it to the
@@ -98,7 +122,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
         old_map);
     int secondary_offset = SecondaryOffset(
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key)), seed);
-    Entry* secondary = entry(secondary_, secondary_offset);
+    Entry* secondary = secondary_entry(secondary_offset);
     *secondary = *primary;
   }
 
@@ -106,18 +130,23 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
   primary->key = StrongTaggedValue(name);
   primary->value = TaggedValue(handler);
   primary->map = StrongTaggedValue(map);
+  // Saturate just above the growth threshold; Clear() only needs to know
+  // whether it was exceeded.
+  if (updates_since_clear_ <= kGrowthUpdatesPerEntry * primary_size_) {
+    updates_since_clear_++;
+  }
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
 }
 
 MaybeObject StubCache::Get(Name name, Map map) {
   DCHECK(CommonStubCacheChecks(this, name, map, MaybeObject()));
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = primary_entry(primary_offset);
   if (primary->key == name && primary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), primary->value);
   }
   int secondary_offset = SecondaryOffset(name, primary_offset);
-  Entry* secondary = entry(secondary_, secondary_offset);
+  Entry* secondary = secondary_entry(secondary_offset);
   if (secondary->key == name && secondary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), secondary->value);
   }
@@ -125,15 +154,24 @@ MaybeObject StubCache::Get(Name name, Map map) {
 }
 
 void StubCache::Clear() {
+  if (FLAG_adaptive_stub_cache &&
+      updates_since_clear_ > kGrowthUpdatesPerEntry * primary_size_ &&
+      primary_size_ < kMaxPrimaryTableSize) {
+    AllocateTables(primary_size_ * 2,
+                   std::min(secondary_size_ * 2, kMaxSecondaryTableSize));
+    isolate()->counters()->megamorphic_stub_cache_resizes()->Increment();
+  }
+  updates_since_clear_ = 0;
+
   MaybeObject empty = MaybeObject::FromObject(
       isolate_->builtins()->builtin(Builtins::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_size_; i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_size_; j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
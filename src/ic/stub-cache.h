@@ -15,6 +15,11 @@ namespace internal {
 // It maps (map, name, type) to property access handlers. The cache does not
 // need explicit invalidation when a prototype chain is modified, since the
 // handlers verify the chain.
+//
+// The tables start out small and grow when they are cleared at a GC if
+// handlers had to be replaced much more often than there are entries since
+// the previous clear, i.e. if the working set of the megamorphic accesses did
+// not fit.
 
 
 class SCTableReference {
@@ -46,32 +51,42 @@ class V8_EXPORT_PRIVATE StubCache {
   // Access cache for entry hash(name, map).
   void Set(Name name, Map map, MaybeObject handler);
   MaybeObject Get(Name name, Map map);
-  // Clear the lookup table (@ mark compact collection).
+  // Clear the lookup table (@ mark compact collection). Grows the tables
+  // first if they were too small for the accesses since the last clear.
   void Clear();
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
-  }
-
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
+  // The address of the pointer to the first entry of {table}. Generated code
+  // loads the table from there, since it moves when the table grows.
+  SCTableReference table_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_));
+    }
+    UNREACHABLE();
   }
 
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  // The address of the uint32_t mask that generated code applies to offsets
+  // computed for {table}.
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
   }
 
-  StubCache::Entry* first_entry(StubCache::Table table) {
+  int table_size(StubCache::Table table) const {
     switch (table) {
       case StubCache::kPrimary:
-        return StubCache::primary_;
+        return primary_size_;
       case StubCache::kSecondary:
-        return StubCache::secondary_;
+        return secondary_size_;
     }
     UNREACHABLE();
   }
@@ -85,11 +100,23 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::kHashShift;
 
+  // The initial table sizes.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
+  // The sizes the tables can grow to. Offsets are computed for these sizes
+  // and masked down to the current size of the table.
+  static const int kMaxPrimaryTableBits = 13;
+  static const int kMaxPrimaryTableSize = (1 << kMaxPrimaryTableBits);
+  static const int kMaxSecondaryTableBits = 11;
+  static const int kMaxSecondaryTableSize = (1 << kMaxSecondaryTableBits);
+
+  // The tables grow if there were more than this many updates per primary
+  // entry since the last clear.
+  static const int kGrowthUpdatesPerEntry = 4;
+
   // We compute the hash code for a map as follows:
   //   <code> = <address> ^ (<address> >> kMapKeyShift)
   static const int kMapKeyShift = kPrimaryTableBits + kCacheIndexShift;
@@ -102,6 +129,7 @@ class V8_EXPORT_PRIVATE StubCache {
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -114,15 +142,19 @@ class V8_EXPORT_PRIVATE StubCache {
   // entries are overwritten.
 
   // Hash algorithm for the primary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
+  // assembler for every architecture.  Returns an index into a table of
+  // kMaxPrimaryTableSize entries that is scaled by 1 << kCacheIndexShift.
   static int PrimaryOffset(Name name, Map map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
+  // assembler for every architecture.  Returns an index into a table of
+  // kMaxSecondaryTableSize entries that is scaled by 1 << kCacheIndexShift.
   static int SecondaryOffset(Name name, int seed);
 
+  // Replaces the tables with new ones of the given sizes. The new tables
+  // still have to be cleared.
+  void AllocateTables(int primary_size, int secondary_size);
+
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
   // ends in Name::kHashShift 0s.  Then we multiply it so it is a multiple
@@ -137,9 +169,25 @@ class V8_EXPORT_PRIVATE StubCache {
                                     offset * multiplier);
   }
 
+  Entry* primary_entry(int offset) {
+    return entry(primary_, offset & primary_mask_);
+  }
+  Entry* secondary_entry(int offset) {
+    return entry(secondary_, offset & secondary_mask_);
+  }
+
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_ = nullptr;
+  Entry* secondary_ = nullptr;
+  // The masks turn offsets for the maximum table sizes into offsets into the
+  // current tables.
+  uint32_t primary_mask_ = 0;
+  uint32_t secondary_mask_ = 0;
+  int primary_size_ = 0;
+  int secondary_size_ = 0;
+  // Number of Set() calls since the last Clear(), saturated just above the
+  // growth threshold.
+  int updates_since_clear_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -160,6 +160,8 @@ namespace internal {
      V8.TurboFanOptimizeNonConcurrentTotalTime, 10000000, MICROSECOND)         \
   HT(turbofan_optimize_concurrent_total_time,                                  \
      V8.TurboFanOptimizeConcurrentTotalTime, 10000000, MICROSECOND)            \
+  HT(turbofan_optimize_queue_latency, V8.TurboFanOptimizeQueueLatency,         \
+     10000000, MICROSECOND)                                                    \
   HT(turbofan_osr_prepare, V8.TurboFanOptimizeForOnStackReplacementPrepare,    \
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_execute, V8.TurboFanOptimizeForOnStackReplacementExecute,    \
@@ -168,6 +170,10 @@ namespace internal {
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_total_time,                                                  \
      V8.TurboFanOptimizeForOnStackReplacementTotalTime, 10000000, MICROSECOND) \
+  HT(turboprop_optimize_total_time, V8.TurboPropOptimizeTotalTime, 10000000,   \
+     MICROSECOND)                                                              \
+  HT(turboprop_optimize_total_background,                                      \
+     V8.TurboPropOptimizeTotalBackground, 10000000, MICROSECOND)               \
   /* Wasm timers. */                                                           \
   HT(wasm_compile_asm_module_time, V8.WasmCompileModuleMicroSeconds.asm,       \
      10000000, MICROSECOND)                                                    \
@@ -287,6 +293,7 @@ namespace internal {
   SC(cow_arrays_converted, V8.COWArraysConverted)                              \
   SC(constructed_objects_runtime, V8.ConstructedObjectsRuntime)                \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_resizes, V8.MegamorphicStubCacheResizes)           \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(string_add_runtime, V8.StringAddRuntime)                                  \
@@ -310,6 +317,11 @@ namespace internal {
   SC(lo_space_bytes_available, V8.MemoryLoSpaceBytesAvailable)                 \
   SC(lo_space_bytes_committed, V8.MemoryLoSpaceBytesCommitted)                 \
   SC(lo_space_bytes_used, V8.MemoryLoSpaceBytesUsed)                           \
+  /* Number and size of allocated feedback vectors and closure cell arrays. */ \
+  SC(feedback_vectors_created, V8.FeedbackVectorsCreated)                      \
+  SC(feedback_vector_bytes_created, V8.FeedbackVectorBytesCreated)             \
+  SC(closure_feedback_cell_array_bytes_created,                                \
+     V8.ClosureFeedbackCellArrayBytesCreated)                                  \
   /* Total code size (including metadata) of baseline code or bytecode. */     \
   SC(total_baseline_code_size, V8.TotalBaselineCodeSize)                       \
   /* Total count of functions compiled using the baseline compiler. */         \
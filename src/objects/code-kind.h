@@ -14,6 +14,9 @@ namespace internal {
 // The order of INTERPRETED_FUNCTION to TURBOFAN is important. We use it to
 // check the relative ordering of the tiers when fetching / installing optimized
 // code.
+// TODO(v8): Add a non-optimizing baseline tier between INTERPRETED_FUNCTION
+// and the optimizing tiers that compiles bytecode straight to calls into the
+// bytecode handlers' builtins while keeping the interpreter frame layout.
 #define CODE_KIND_LIST(V)       \
   V(BYTECODE_HANDLER)           \
   V(FOR_TESTING)                \
@@ -184,6 +184,15 @@ void OffHeapCompressedObjectSlot::Release_CompareAndSwap(Object old,
   AsAtomicTagged::Release_CompareAndSwap(location(), old_ptr, target_ptr);
 }
 
+Object OffHeapCompressedObjectSlot::Release_CompareAndSwap(
+    IsolateRoot isolate, Object old, Object target) const {
+  Tagged_t old_ptr = CompressTagged(old.ptr());
+  Tagged_t target_ptr = CompressTagged(target.ptr());
+  Tagged_t result =
+      AsAtomicTagged::Release_CompareAndSwap(location(), old_ptr, target_ptr);
+  return Object(DecompressTaggedAny(isolate, result));
+}
+
 }  // namespace internal
 }  // namespace v8
 
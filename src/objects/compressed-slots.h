@@ -139,6 +139,9 @@ class OffHeapCompressedObjectSlot
   inline void Relaxed_Store(Object value) const;
   inline void Release_Store(Object value) const;
   inline void Release_CompareAndSwap(Object old, Object target) const;
+  // Returns the previous value of the slot.
+  inline Object Release_CompareAndSwap(IsolateRoot isolate, Object old,
+                                       Object target) const;
 };
 
 #endif  // V8_COMPRESS_POINTERS
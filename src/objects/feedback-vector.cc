@@ -9,6 +9,7 @@
 #include "src/heap/local-factory-inl.h"
 #include "src/ic/handler-configuration-inl.h"
 #include "src/ic/ic-inl.h"
+#include "src/logging/counters.h"
 #include "src/objects/data-handler-inl.h"
 #include "src/objects/feedback-vector-inl.h"
 #include "src/objects/hash-table-inl.h"
@@ -223,6 +224,11 @@ Handle<ClosureFeedbackCellArray> ClosureFeedbackCellArray::New(
 
   Handle<ClosureFeedbackCellArray> feedback_cell_array =
       factory->NewClosureFeedbackCellArray(num_feedback_cells);
+  if (num_feedback_cells > 0) {
+    isolate->counters()->closure_feedback_cell_array_bytes_created()->Increment(
+        feedback_cell_array->Size() +
+        num_feedback_cells * FeedbackCell::kAlignedSize);
+  }
 
   for (int i = 0; i < num_feedback_cells; i++) {
     Handle<FeedbackCell> cell =
@@ -248,6 +254,9 @@ Handle<FeedbackVector> FeedbackVector::New(
       factory->NewFeedbackVector(shared, closure_feedback_cell_array);
 
   DCHECK_EQ(vector->length(), slot_count);
+  isolate->counters()->feedback_vectors_created()->Increment();
+  isolate->counters()->feedback_vector_bytes_created()->Increment(
+      vector->Size());
 
   DCHECK_EQ(vector->shared_function_info(), *shared);
   DCHECK_EQ(vector->optimization_marker(),
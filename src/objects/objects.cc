@@ -5944,6 +5944,15 @@ Handle<Derived> Dictionary<Derived, Shape>::Add(LocalIsolate* isolate,
   uint32_t hash = Shape::Hash(roots, key);
   // Validate that the key is absent.
   SLOW_DCHECK(dictionary->FindEntry(isolate, key).is_not_found());
+  // Deleted entries lengthen probe sequences.  If they are all that keeps the
+  // dictionary from taking another element, wipe them in place instead of
+  // letting EnsureCapacity allocate a copy with the same capacity.
+  if (dictionary->NumberOfDeletedElements() > 0 &&
+      !dictionary->HasSufficientCapacityToAdd(1) &&
+      HashTable<Derived, Shape>::HasSufficientCapacityToAdd(
+          dictionary->Capacity(), dictionary->NumberOfElements(), 0, 1)) {
+    dictionary->Rehash(isolate);
+  }
   // Check whether the dictionary should be extended.
   dictionary = Derived::EnsureCapacity(isolate, dictionary);
 
@@ -97,6 +97,10 @@ Handle<Derived> OrderedHashTable<Derived, entrysize>::Shrink(
   int nof = table->NumberOfElements();
   int capacity = table->Capacity();
   if (nof >= (capacity >> 2)) return table;
+  // Halving a minimum-size table would just allocate a copy of the same size.
+  // Leave the deleted entries in place; EnsureGrowable clears them out once
+  // they actually get in the way of an insertion.
+  if (capacity <= kInitialCapacity) return table;
   return Derived::Rehash(isolate, table, capacity / 2).ToHandleChecked();
 }
 
@@ -231,6 +231,9 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, may_have_cached_code,
                     SharedFunctionInfo::MayHaveCachedCodeBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, was_marked_hot,
+                    SharedFunctionInfo::WasMarkedHotBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -405,6 +405,12 @@ class SharedFunctionInfo
   // hence the 'may'.
   DECL_BOOLEAN_ACCESSORS(may_have_cached_code)
 
+  // True if the runtime profiler marked a closure of this SFI for
+  // optimization as hot and stable. Only set with --cache-hotness-hints. The
+  // bit is part of the SFI and therefore survives the code cache, which lets
+  // a later process tier the function up after a single profiler tick.
+  DECL_BOOLEAN_ACCESSORS(was_marked_hot)
+
   // Returns the cached Code object for this SFI if it exists, an empty handle
   // otherwise.
   MaybeHandle<Code> TryGetCachedCode(Isolate* isolate);
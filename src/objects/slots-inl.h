@@ -71,6 +71,16 @@ Object FullObjectSlot::Release_CompareAndSwap(Object old, Object target) const {
   return Object(result);
 }
 
+//
+// OffHeapFullObjectSlot implementation.
+//
+
+Object OffHeapFullObjectSlot::Release_CompareAndSwap(IsolateRoot isolate,
+                                                     Object old,
+                                                     Object target) const {
+  return FullObjectSlot::Release_CompareAndSwap(old, target);
+}
+
 //
 // FullMaybeObjectSlot implementation.
 //
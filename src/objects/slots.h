@@ -271,6 +271,11 @@ class OffHeapFullObjectSlot : public FullObjectSlot {
 
   using FullObjectSlot::Relaxed_Load;
   inline Object Relaxed_Load() const = delete;
+
+  using FullObjectSlot::Release_CompareAndSwap;
+  // Returns the previous value of the slot, like the compressed version.
+  inline Object Release_CompareAndSwap(IsolateRoot isolate, Object old,
+                                       Object target) const;
 };
 
 }  // namespace internal
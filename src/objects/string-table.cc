@@ -106,25 +106,57 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
+  // Stores {entry} at {index} if the slot still holds {expected}. Returns
+  // whether this call stored the entry. This doesn't depend on the identity
+  // of {entry}: another thread may have inserted the very same string.
+  bool TryClaim(IsolateRoot isolate, InternalIndex index, Object expected,
+                String entry) {
+    DCHECK(expected == empty_element() || expected == deleted_element());
+    return slot(index).Release_CompareAndSwap(isolate, expected, entry) ==
+           expected;
+  }
+
   void ElementAdded() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
         capacity(), number_of_elements(), number_of_deleted_elements(), 1));
 
-    number_of_elements_++;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
   }
   void DeletedElementOverwritten() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
         capacity(), number_of_elements(), number_of_deleted_elements() - 1, 1));
 
-    number_of_elements_++;
-    number_of_deleted_elements_--;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
   void ElementsRemoved(int count) {
-    DCHECK_LE(count, number_of_elements_);
-    number_of_elements_ -= count;
-    number_of_deleted_elements_ += count;
+    DCHECK_LE(count, number_of_elements());
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  // Concurrent inserts, which hold the write mutex only in shared mode,
+  // reserve their element up front so that together they can never fill the
+  // table. Fails if the table has to be resized first.
+  bool TryReserveElement() {
+    int nof = number_of_elements_.fetch_add(1, std::memory_order_relaxed);
+    if (ComputeStringTableCapacityWithShrink(capacity(), nof + 1) ==
+            capacity() &&
+        StringTableHasSufficientCapacityToAdd(
+            capacity(), nof, number_of_deleted_elements(), 1)) {
+      return true;
+    }
+    CancelReservedElement();
+    return false;
+  }
+  void CancelReservedElement() {
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  void ReservedElementOverwroteDeleted() {
+    DCHECK_LT(0, number_of_deleted_elements());
+    number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
 
   void* operator new(size_t size, int capacity);
@@ -132,8 +164,12 @@ class StringTable::Data {
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
-  int number_of_deleted_elements() const { return number_of_deleted_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
+  int number_of_deleted_elements() const {
+    return number_of_deleted_elements_.load(std::memory_order_relaxed);
+  }
 
   template <typename LocalIsolate, typename StringTableKey>
   InternalIndex FindEntry(LocalIsolate* isolate, StringTableKey* key,
@@ -175,8 +211,8 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
-  int number_of_deleted_elements_;
+  std::atomic<int> number_of_elements_;
+  std::atomic<int> number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
 };
@@ -241,7 +277,8 @@ std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
     InternalIndex insertion_index = new_data->FindInsertionEntry(isolate, hash);
     new_data->Set(insertion_index, string);
   }
-  new_data->number_of_elements_ = data->number_of_elements();
+  new_data->number_of_elements_.store(data->number_of_elements(),
+                                      std::memory_order_relaxed);
 
   new_data->previous_data_ = std::move(data);
   return new_data;
@@ -338,7 +375,9 @@ int StringTable::Capacity() const {
 }
 int StringTable::NumberOfElements() const {
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    // Take the lock exclusively so that reservations of concurrent inserts
+    // are not counted.
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
     return data_.load(std::memory_order_relaxed)->number_of_elements();
   }
 }
@@ -433,7 +472,7 @@ Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
   //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
+  //     mutex, held exclusively for resizes and at least shared for inserts,
   //   - Resizes of the string table first copies the old contents to the new
   //     table, and only then sets the new string table pointer to the new
   //     table,
@@ -455,6 +494,14 @@ Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
   // and on a miss we take the lock and try to write the entry, with a second
   // read lookup in case the non-locked read missed a write.
   //
+  // Inserts that don't need a resize only take the lock in shared mode, so
+  // that background threads internalizing strings don't serialize on each
+  // other. They claim their slot with a compare-and-swap; a thread that loses
+  // the race for a slot looks the key up again, and finds the winner's string
+  // if it was the same key. Since slots only ever go from free to used
+  // outside of GC, two threads inserting the same key agree on the first free
+  // slot of its probe sequence and cannot both succeed.
+  //
   // One complication is allocation -- we don't want to allocate while holding
   // the string table lock. This applies to both allocation of new strings, and
   // re-allocation of the string table on resize. So, we optimistically allocate
@@ -485,9 +532,42 @@ Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
   Handle<String> new_string = key->AsHandle(isolate);
 
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kShared> table_insert_guard(&write_mutex_);
+
+    // The data pointer can only change while the lock is held exclusively.
+    Data* data = data_.load(std::memory_order_relaxed);
+    if (data->TryReserveElement()) {
+      while (true) {
+        entry = data->FindEntryOrInsertionEntry(isolate, key, key->hash());
+        Object element = data->Get(isolate, entry);
+        if (element != empty_element() && element != deleted_element()) {
+          // Return the existing string as a handle.
+          data->CancelReservedElement();
+          return handle(String::cast(element), isolate);
+        }
+        if (data->TryClaim(isolate, entry, element, *new_string)) {
+          if (element == deleted_element()) {
+            data->ReservedElementOverwroteDeleted();
+          }
+          return new_string;
+        }
+        // Another thread took this entry in the meantime, try again.
+      }
+    }
+  }
+
+  {
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
+#ifdef DEBUG
+    write_mutex_exclusive_owner_.store(ThreadId::Current(),
+                                       std::memory_order_relaxed);
+#endif
 
     Data* data = EnsureCapacity(isolate, 1);
+#ifdef DEBUG
+    write_mutex_exclusive_owner_.store(ThreadId::Invalid(),
+                                       std::memory_order_relaxed);
+#endif
 
     // Check one last time if the key is present in the table, in case it was
     // added after the check.
@@ -532,8 +612,9 @@ template Handle<String> StringTable::LookupKey(Isolate* isolate,
 
 StringTable::Data* StringTable::EnsureCapacity(IsolateRoot isolate,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
+  // This call is only allowed while the write mutex is held exclusively.
+  DCHECK(write_mutex_exclusive_owner_.load(std::memory_order_relaxed) ==
+         ThreadId::Current());
 
   // This load can be relaxed as the table pointer can only be modified while
   // the lock is held.
@@ -6,6 +6,7 @@
 #define V8_OBJECTS_STRING_TABLE_H_
 
 #include "src/common/assert-scope.h"
+#include "src/execution/thread-id.h"
 #include "src/objects/string.h"
 #include "src/roots/roots.h"
 
@@ -88,10 +89,14 @@ class V8_EXPORT_PRIVATE StringTable {
 
   std::atomic<Data*> data_;
   // Write mutex is mutable so that readers of concurrently mutated values (e.g.
-  // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  // NumberOfElements) are allowed to lock it while staying const. Resizes hold
+  // it exclusively, inserts into a table with enough room share it.
+  mutable base::SharedMutex write_mutex_;
 #ifdef DEBUG
   Isolate* isolate_;
+  // The thread that holds {write_mutex_} exclusively while it calls
+  // EnsureCapacity, if any.
+  std::atomic<ThreadId> write_mutex_exclusive_owner_{ThreadId::Invalid()};
 #endif
 };
 
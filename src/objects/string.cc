@@ -620,6 +620,36 @@ void String::WriteToFlat(String source, sinkchar* sink, int from, int to) {
                      SharedStringAccessGuardIfNeeded::NotNeeded());
 }
 
+namespace {
+
+// Copies the characters between {from} and {to} of a sequential {source} into
+// {sink}. Returns false if {source} is not sequential. Ropes built in a loop
+// mostly have sequential leaves, which this lets WriteToFlat copy without
+// another recursion.
+template <typename sinkchar>
+bool TryWriteSequentialToFlat(
+    String source, sinkchar* sink, int from, int to,
+    const DisallowGarbageCollection& no_gc,
+    const SharedStringAccessGuardIfNeeded& access_guard) {
+  if (source.IsSeqOneByteString()) {
+    CopyChars(
+        sink,
+        SeqOneByteString::cast(source).GetChars(no_gc, access_guard) + from,
+        to - from);
+    return true;
+  }
+  if (source.IsSeqTwoByteString()) {
+    CopyChars(
+        sink,
+        SeqTwoByteString::cast(source).GetChars(no_gc, access_guard) + from,
+        to - from);
+    return true;
+  }
+  return false;
+}
+
+}  // namespace
+
 template <typename sinkchar>
 void String::WriteToFlat(String source, sinkchar* sink, int from, int to,
                          const SharedStringAccessGuardIfNeeded& access_guard) {
@@ -660,7 +690,13 @@ void String::WriteToFlat(String source, sinkchar* sink, int from, int to,
         if (to - boundary >= boundary - from) {
           // Right hand side is longer.  Recurse over left.
           if (from < boundary) {
-            WriteToFlat(first, sink, from, boundary, access_guard);
+            // When repeatedly prepending to a string, we get a cons string that
+            // is unbalanced to the right.  Its left children are mostly
+            // sequential, copy those directly.
+            if (!TryWriteSequentialToFlat(first, sink, from, boundary, no_gc,
+                                          access_guard)) {
+              WriteToFlat(first, sink, from, boundary, access_guard);
+            }
             if (from == 0 && cons_string.second() == first) {
               CopyChars(sink + boundary, sink, boundary);
               return;
@@ -678,15 +714,12 @@ void String::WriteToFlat(String source, sinkchar* sink, int from, int to,
             String second = cons_string.second();
             // When repeatedly appending to a string, we get a cons string that
             // is unbalanced to the left, a list, essentially.  We inline the
-            // common case of sequential one-byte right child.
+            // common case of a sequential right child.
             if (to - boundary == 1) {
               sink[boundary - from] = static_cast<sinkchar>(second.Get(0));
-            } else if (second.IsSeqOneByteString()) {
-              CopyChars(
-                  sink + boundary - from,
-                  SeqOneByteString::cast(second).GetChars(no_gc, access_guard),
-                  to - boundary);
-            } else {
+            } else if (!TryWriteSequentialToFlat(second, sink + boundary - from,
+                                                 0, to - boundary, no_gc,
+                                                 access_guard)) {
               WriteToFlat(second, sink + boundary - from, 0, to - boundary,
                           access_guard);
             }
@@ -699,10 +732,11 @@ void String::WriteToFlat(String source, sinkchar* sink, int from, int to,
       case kOneByteStringTag | kSlicedStringTag:
       case kTwoByteStringTag | kSlicedStringTag: {
         SlicedString slice = SlicedString::cast(source);
-        unsigned offset = slice.offset();
-        WriteToFlat(slice.parent(), sink, from + offset, to + offset,
-                    access_guard);
-        return;
+        int offset = slice.offset();
+        source = slice.parent();
+        from += offset;
+        to += offset;
+        break;
       }
       case kOneByteStringTag | kThinStringTag:
       case kTwoByteStringTag | kThinStringTag:
@@ -725,6 +725,11 @@ class ConsString : public TorqueGeneratedConsString<ConsString, String> {
   // Minimum length for a cons string.
   static const int kMinLength = 13;
 
+  // Maximum length up to which StringAdd merges a short appended string into
+  // the sequential second part of a cons string, instead of creating a cons
+  // string on top of it.
+  static const int kMaxMergedSecondLength = 64;
+
   class BodyDescriptor;
 
   DECL_VERIFIER(ConsString)
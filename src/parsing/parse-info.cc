@@ -37,6 +37,7 @@ UnoptimizedCompileFlags::UnoptimizedCompileFlags(Isolate* isolate,
                                isolate->NeedsDetailedOptimizedCodeLineInfo());
   set_allow_harmony_top_level_await(FLAG_harmony_top_level_await);
   set_allow_harmony_logical_assignment(FLAG_harmony_logical_assignment);
+  set_post_parallel_compile_tasks(FLAG_parallel_compile_tasks);
 }
 
 // static
@@ -324,6 +325,12 @@ void ParseInfo::CheckFlagsForFunctionFromScript(Script script) {
                  source_range_map() != nullptr);
 }
 
+void UnoptimizedCompileState::EnableParallelTasks(
+    CompilerDispatcher* compiler_dispatcher) {
+  if (parallel_tasks_) return;
+  parallel_tasks_.reset(new ParallelTasks(compiler_dispatcher));
+}
+
 void UnoptimizedCompileState::ParallelTasks::Enqueue(
     ParseInfo* outer_parse_info, const AstRawString* function_name,
     FunctionLiteral* literal) {
@@ -64,7 +64,8 @@ class Zone;
   V(collect_source_positions, bool, 1, _)                \
   V(allow_harmony_top_level_await, bool, 1, _)           \
   V(is_repl_mode, bool, 1, _)                            \
-  V(allow_harmony_logical_assignment, bool, 1, _)
+  V(allow_harmony_logical_assignment, bool, 1, _)        \
+  V(post_parallel_compile_tasks, bool, 1, _)
 
 class V8_EXPORT_PRIVATE UnoptimizedCompileFlags {
  public:
@@ -188,6 +189,9 @@ class V8_EXPORT_PRIVATE UnoptimizedCompileState {
     return &pending_error_handler_;
   }
   ParallelTasks* parallel_tasks() const { return parallel_tasks_.get(); }
+  // Sets up parallel tasks for a compile that asked for them, even if the
+  // compiler dispatcher isn't enabled by flag.
+  void EnableParallelTasks(CompilerDispatcher* compiler_dispatcher);
 
  private:
   uint64_t hash_seed_;
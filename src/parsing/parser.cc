@@ -2586,7 +2586,7 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   // in a parallel task on a worker thread.
   bool should_post_parallel_task =
       parse_lazily() && is_eager_top_level_function &&
-      FLAG_parallel_compile_tasks && info()->parallel_tasks() &&
+      flags().post_parallel_compile_tasks() && info()->parallel_tasks() &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
   // This may be modified later to reflect preparsing decision taken
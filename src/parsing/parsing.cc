@@ -23,6 +23,12 @@ namespace parsing {
 
 namespace {
 
+// Parallel compile tasks are only posted for sources that can be read off the
+// main thread. On-heap sources at least this long are copied off-heap so that
+// their eager top-level functions can be compiled in parallel; for shorter
+// sources the copy isn't worth it.
+constexpr int kMinSourceLengthForParallelCompileTasks = 16 * KB;
+
 void MaybeReportErrorsAndStatistics(ParseInfo* info, Handle<Script> script,
                                     Isolate* isolate, Parser* parser,
                                     ReportStatisticsMode mode) {
@@ -49,7 +55,10 @@ bool ParseProgram(ParseInfo* info, Handle<Script> script,
   Handle<String> source(String::cast(script->source()), isolate);
   isolate->counters()->total_parse_size()->Increment(source->length());
   std::unique_ptr<Utf16CharacterStream> stream(
-      ScannerStream::For(isolate, source));
+      info->flags().post_parallel_compile_tasks() && info->parallel_tasks() &&
+              source->length() >= kMinSourceLengthForParallelCompileTasks
+          ? ScannerStream::ForParallelAccess(isolate, source)
+          : ScannerStream::For(isolate, source));
   info->set_character_stream(std::move(stream));
 
   Parser parser(info);
@@ -124,6 +124,30 @@ class ExternalStringStream {
   const size_t length_;
 };
 
+// A Char stream backed by an off-heap copy of a sequential string. Unlike
+// OnHeapStream it can be cloned and read from background threads; the copy
+// stays alive until the last clone is gone.
+template <typename Char>
+class CopiedStringStream {
+ public:
+  CopiedStringStream(std::shared_ptr<const Char> data, size_t length)
+      : data_(std::move(data)), length_(length) {}
+
+  // The no_gc argument is only here because of the templated way this class
+  // is used along with other implementations that require V8 heap access.
+  Range<Char> GetDataAt(size_t pos, RuntimeCallStats* stats,
+                        DisallowGarbageCollection* no_gc = nullptr) {
+    return {&data_.get()[std::min(length_, pos)], &data_.get()[length_]};
+  }
+
+  static const bool kCanBeCloned = true;
+  static const bool kCanAccessHeap = false;
+
+ private:
+  std::shared_ptr<const Char> data_;
+  const size_t length_;
+};
+
 // A Char stream backed by a C array. Testing only.
 template <typename Char>
 class TestingStream {
@@ -785,6 +809,29 @@ Utf16CharacterStream* ScannerStream::For(Isolate* isolate, Handle<String> data,
   }
 }
 
+Utf16CharacterStream* ScannerStream::ForParallelAccess(Isolate* isolate,
+                                                       Handle<String> data) {
+  data = String::Flatten(isolate, data);
+  if (!data->IsSeqString()) return ScannerStream::For(isolate, data);
+
+  size_t length = static_cast<size_t>(data->length());
+  DisallowGarbageCollection no_gc;
+  if (data->IsSeqOneByteString()) {
+    std::shared_ptr<uint8_t> copy(new uint8_t[length],
+                                  std::default_delete<uint8_t[]>());
+    CopyChars(copy.get(), SeqOneByteString::cast(*data).GetChars(no_gc),
+              length);
+    return new BufferedCharacterStream<CopiedStringStream>(
+        0, std::shared_ptr<const uint8_t>(std::move(copy)), length);
+  }
+  DCHECK(data->IsSeqTwoByteString());
+  std::shared_ptr<uint16_t> copy(new uint16_t[length],
+                                 std::default_delete<uint16_t[]>());
+  CopyChars(copy.get(), SeqTwoByteString::cast(*data).GetChars(no_gc), length);
+  return new UnbufferedCharacterStream<CopiedStringStream>(
+      0, std::shared_ptr<const uint16_t>(std::move(copy)), length);
+}
+
 std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
     const char* data) {
   return ScannerStream::ForTesting(data, strlen(data));
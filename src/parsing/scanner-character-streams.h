@@ -27,6 +27,11 @@ class V8_EXPORT_PRIVATE ScannerStream {
   static Utf16CharacterStream* For(
       ScriptCompiler::ExternalSourceStream* source_stream,
       ScriptCompiler::StreamedSource::Encoding encoding);
+  // Like For(isolate, data), but the returned stream never reads from the V8
+  // heap and can be cloned for background threads. Sequential strings are
+  // copied off-heap for this.
+  static Utf16CharacterStream* ForParallelAccess(Isolate* isolate,
+                                                 Handle<String> data);
 
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data);
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data,
@@ -4,6 +4,10 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 #include "src/base/optional.h"
 #include "src/common/assert-scope.h"
 #include "src/objects/fixed-array-inl.h"
@@ -552,6 +556,210 @@ class NfaInterpreter {
   Zone* zone_;
 };
 
+template <class Character>
+class LazyDfa {
+  // Decides whether a bytecode program matches anywhere in the input at or
+  // after a given index by simulating the subset construction of the NFA
+  // described by the bytecode.  DFA states and transitions are only computed
+  // when the input requires them, so the cost of a transition that was seen
+  // before is a single table lookup, compared to stepping every thread of the
+  // `NfaInterpreter`.
+  //
+  // The DFA only answers whether there is a match, not where it begins or
+  // which captures it has; thread priorities and registers are irrelevant for
+  // that.  It is used to skip the `NfaInterpreter` for subjects without a
+  // match.  Assertions depend on the context of the current input position,
+  // so programs containing ASSERTION instructions are not supported.
+  //
+  // Input characters are partitioned into equivalence classes such that all
+  // characters in a class are accepted by the same CONSUME_RANGE
+  // instructions, which keeps the transition table small also for two-byte
+  // subjects.  If the number of states would exceed a fixed budget, the DFA
+  // gives up and the caller falls back to the `NfaInterpreter`.
+ public:
+  enum class Result { kMatch, kNoMatch, kGaveUp };
+
+  explicit LazyDfa(Vector<const RegExpInstruction> bytecode)
+      : bytecode_(bytecode) {}
+
+  static bool CanBeHandled(Vector<const RegExpInstruction> bytecode) {
+    return std::none_of(bytecode.begin(), bytecode.end(),
+                        [](const RegExpInstruction& inst) {
+                          return inst.opcode == RegExpInstruction::ASSERTION;
+                        });
+  }
+
+  Result Run(Vector<const Character> input, int start_index) {
+    DCHECK(CanBeHandled(bytecode_));
+    ComputeCharacterClasses();
+
+    std::vector<int> start_pcs{0};
+    int state = AddState(&start_pcs);
+    for (int i = start_index;; ++i) {
+      if (states_[state].accepting) return Result::kMatch;
+      if (states_[state].consume_pcs.empty()) return Result::kNoMatch;
+      if (i == input.length()) return Result::kNoMatch;
+
+      const int index = state * class_count_ + ClassOf(input[i]);
+      int next_state = transitions_[index];
+      if (next_state == kUnknownState) {
+        next_state = ComputeTransition(state, ClassOf(input[i]));
+        if (next_state == kUnknownState) return Result::kGaveUp;
+        transitions_[index] = next_state;
+      }
+      state = next_state;
+    }
+  }
+
+ private:
+  struct State {
+    // Sorted program counters of the CONSUME_RANGE instructions that threads
+    // in this state are blocked on.
+    std::vector<int> consume_pcs;
+    // Whether some thread in this state executed ACCEPT.
+    bool accepting;
+  };
+
+  static constexpr int kUnknownState = -1;
+  // Upper bound on the size of the transition table, i.e. the number of
+  // states times the number of character classes.
+  static constexpr int kMaxTransitionTableSize = 64 * KB;
+
+  void ComputeCharacterClasses() {
+    // Every class is a maximal interval of characters that no range bound
+    // falls into; `class_starts_` holds the smallest character of each class.
+    class_starts_.push_back(0);
+    for (const RegExpInstruction& inst : bytecode_) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      class_starts_.push_back(inst.payload.consume_range.min);
+      if (inst.payload.consume_range.max < kMaxUInt16) {
+        class_starts_.push_back(inst.payload.consume_range.max + 1);
+      }
+    }
+    std::sort(class_starts_.begin(), class_starts_.end());
+    class_starts_.erase(std::unique(class_starts_.begin(), class_starts_.end()),
+                        class_starts_.end());
+    class_count_ = static_cast<int>(class_starts_.size());
+
+    for (int c = 0; c < kOneByteClassTableSize; ++c) {
+      one_byte_classes_[c] = ClassOfSlow(c);
+    }
+  }
+
+  int ClassOfSlow(uc16 c) const {
+    auto it = std::upper_bound(class_starts_.begin(), class_starts_.end(), c);
+    DCHECK_NE(it, class_starts_.begin());
+    return static_cast<int>(it - class_starts_.begin()) - 1;
+  }
+
+  int ClassOf(Character c) const {
+    if (c < kOneByteClassTableSize) return one_byte_classes_[c];
+    return ClassOfSlow(c);
+  }
+
+  // Adds the state reached from the program counters in `pcs` by following
+  // all instructions that don't consume input, unless an equal state exists
+  // already.  Returns the index of the state, or kUnknownState if the
+  // transition table budget is exhausted.  Clobbers `pcs`.
+  int AddState(std::vector<int>* pcs) {
+    State state{{}, false};
+    std::vector<bool> visited(bytecode_.length(), false);
+    while (!pcs->empty()) {
+      int pc = pcs->back();
+      pcs->pop_back();
+      while (!visited[pc]) {
+        visited[pc] = true;
+        RegExpInstruction inst = bytecode_[pc];
+        if (inst.opcode == RegExpInstruction::CONSUME_RANGE) {
+          state.consume_pcs.push_back(pc);
+          break;
+        } else if (inst.opcode == RegExpInstruction::ACCEPT) {
+          state.accepting = true;
+          break;
+        } else if (inst.opcode == RegExpInstruction::FORK) {
+          pcs->push_back(inst.payload.pc);
+          ++pc;
+        } else if (inst.opcode == RegExpInstruction::JMP) {
+          pc = inst.payload.pc;
+        } else {
+          DCHECK(inst.opcode == RegExpInstruction::SET_REGISTER_TO_CP ||
+                 inst.opcode == RegExpInstruction::CLEAR_REGISTER);
+          ++pc;
+        }
+      }
+    }
+    std::sort(state.consume_pcs.begin(), state.consume_pcs.end());
+    // Once a match was found, the remaining threads don't matter, so all
+    // accepting states can be merged.
+    if (state.accepting) state.consume_pcs.clear();
+
+    auto key = std::make_pair(state.accepting, state.consume_pcs);
+    auto it = state_indices_.find(key);
+    if (it != state_indices_.end()) return it->second;
+
+    const int index = static_cast<int>(states_.size());
+    if ((index + 1) * class_count_ > kMaxTransitionTableSize) {
+      return kUnknownState;
+    }
+    states_.push_back(std::move(state));
+    state_indices_.emplace(std::move(key), index);
+    transitions_.resize(transitions_.size() + class_count_, kUnknownState);
+    return index;
+  }
+
+  int ComputeTransition(int state, int char_class) {
+    // All characters of a class behave the same, so it suffices to look at
+    // the smallest one.
+    const uc16 c = class_starts_[char_class];
+    std::vector<int> next_pcs;
+    for (int pc : states_[state].consume_pcs) {
+      RegExpInstruction::Uc16Range range = bytecode_[pc].payload.consume_range;
+      if (c >= range.min && c <= range.max) next_pcs.push_back(pc + 1);
+    }
+    // Threads are explored in LIFO order by `AddState`; the order doesn't
+    // matter for the resulting state.
+    return AddState(&next_pcs);
+  }
+
+  static constexpr int kOneByteClassTableSize = 256;
+
+  const Vector<const RegExpInstruction> bytecode_;
+  std::vector<uc16> class_starts_;
+  int class_count_ = 0;
+  int one_byte_classes_[kOneByteClassTableSize];
+  std::vector<State> states_;
+  std::map<std::pair<bool, std::vector<int>>, int> state_indices_;
+  // transitions_[s * class_count_ + k] is the index of the state reached from
+  // state s on a character of class k, or kUnknownState if not computed yet.
+  std::vector<int> transitions_;
+};
+
+template <class Character>
+int FindMatchesImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
+                    ByteArray bytecode, int register_count_per_match,
+                    String input, int start_index, int32_t* output_registers,
+                    int output_register_count, Zone* zone) {
+  if (FLAG_experimental_regexp_engine_lazy_dfa) {
+    DisallowGarbageCollection no_gc;
+    Vector<const RegExpInstruction> instructions =
+        ToInstructionVector(bytecode, no_gc);
+    if (LazyDfa<Character>::CanBeHandled(instructions)) {
+      // The DFA runs without interrupt checks; it takes a single table lookup
+      // per character once the states it needs are constructed.
+      LazyDfa<Character> dfa(instructions);
+      if (dfa.Run(ToCharacterVector<Character>(input, no_gc), start_index) ==
+          LazyDfa<Character>::Result::kNoMatch) {
+        return 0;
+      }
+    }
+  }
+
+  NfaInterpreter<Character> interpreter(isolate, call_origin, bytecode,
+                                        register_count_per_match, input,
+                                        start_index, zone);
+  return interpreter.FindMatches(output_registers, output_register_count);
+}
+
 }  // namespace
 
 int ExperimentalRegExpInterpreter::FindMatches(
@@ -562,16 +770,15 @@ int ExperimentalRegExpInterpreter::FindMatches(
   DisallowGarbageCollection no_gc;
 
   if (input.GetFlatContent(no_gc).IsOneByte()) {
-    NfaInterpreter<uint8_t> interpreter(isolate, call_origin, bytecode,
-                                        register_count_per_match, input,
-                                        start_index, zone);
-    return interpreter.FindMatches(output_registers, output_register_count);
+    return FindMatchesImpl<uint8_t>(isolate, call_origin, bytecode,
+                                    register_count_per_match, input,
+                                    start_index, output_registers,
+                                    output_register_count, zone);
   } else {
     DCHECK(input.GetFlatContent(no_gc).IsTwoByte());
-    NfaInterpreter<uc16> interpreter(isolate, call_origin, bytecode,
-                                     register_count_per_match, input,
-                                     start_index, zone);
-    return interpreter.FindMatches(output_registers, output_register_count);
+    return FindMatchesImpl<uc16>(isolate, call_origin, bytecode,
+                                 register_count_per_match, input, start_index,
+                                 output_registers, output_register_count, zone);
   }
 }
 
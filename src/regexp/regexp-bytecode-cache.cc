@@ -0,0 +1,135 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/factory.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct CacheKey {
+  std::vector<uc16> pattern;
+  int flags;
+  bool is_one_byte;
+  uint32_t backtrack_limit;
+
+  bool operator<(const CacheKey& other) const {
+    return std::tie(pattern, flags, is_one_byte, backtrack_limit) <
+           std::tie(other.pattern, other.flags, other.is_one_byte,
+                    other.backtrack_limit);
+  }
+};
+
+struct CacheEntry {
+  std::vector<byte> bytecode;
+  uint32_t backtrack_limit = 0;
+  int register_count = 0;
+};
+
+class SharedBytecodeCache {
+ public:
+  base::Mutex* mutex() { return &mutex_; }
+
+  const CacheEntry* Find(const CacheKey& key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return nullptr;
+    hits_++;
+    return &it->second;
+  }
+
+  void Insert(CacheKey key, CacheEntry entry) {
+    const size_t size = key.pattern.size() * sizeof(uc16) +
+                        entry.bytecode.size() + sizeof(key) + sizeof(entry);
+    if (size_ + size > FLAG_regexp_shared_bytecode_cache_size) return;
+    if (entries_.emplace(std::move(key), std::move(entry)).second) {
+      size_ += size;
+    }
+  }
+
+  size_t hits() const { return hits_; }
+
+ private:
+  base::Mutex mutex_;
+  std::map<CacheKey, CacheEntry> entries_;
+  size_t size_ = 0;
+  size_t hits_ = 0;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedBytecodeCache, GetSharedBytecodeCache)
+
+CacheKey MakeKey(Handle<String> pattern, JSRegExp::Flags flags,
+                 bool is_one_byte, uint32_t backtrack_limit) {
+  DCHECK(pattern->IsFlat());
+  CacheKey key{std::vector<uc16>(pattern->length()), static_cast<int>(flags),
+               is_one_byte, backtrack_limit};
+  String::WriteToFlat(*pattern, key.pattern.data(), 0, pattern->length());
+  return key;
+}
+
+}  // namespace
+
+// static
+MaybeHandle<ByteArray> RegExpBytecodeCache::Lookup(
+    Isolate* isolate, Handle<String> pattern, JSRegExp::Flags flags,
+    bool is_one_byte, uint32_t* backtrack_limit, int* register_count) {
+  if (FLAG_regexp_shared_bytecode_cache_size == 0) return {};
+  CacheKey key = MakeKey(pattern, flags, is_one_byte, *backtrack_limit);
+
+  // Copy the entry out under the lock, but allocate the ByteArray (which may
+  // trigger a GC) after releasing it.
+  CacheEntry entry;
+  {
+    SharedBytecodeCache* cache = GetSharedBytecodeCache();
+    base::MutexGuard guard(cache->mutex());
+    const CacheEntry* cached = cache->Find(key);
+    if (cached == nullptr) return {};
+    entry = *cached;
+  }
+
+  const int length = static_cast<int>(entry.bytecode.size());
+  Handle<ByteArray> bytecode = isolate->factory()->NewByteArray(length);
+  bytecode->copy_in(0, entry.bytecode.data(), length);
+  *backtrack_limit = entry.backtrack_limit;
+  *register_count = entry.register_count;
+  return bytecode;
+}
+
+// static
+void RegExpBytecodeCache::Insert(Handle<String> pattern, JSRegExp::Flags flags,
+                                 bool is_one_byte, uint32_t backtrack_limit,
+                                 ByteArray bytecode,
+                                 uint32_t compiled_backtrack_limit,
+                                 int register_count) {
+  if (FLAG_regexp_shared_bytecode_cache_size == 0) return;
+  CacheKey key = MakeKey(pattern, flags, is_one_byte, backtrack_limit);
+  const byte* start = bytecode.GetDataStartAddress();
+  CacheEntry entry{std::vector<byte>(start, start + bytecode.length()),
+                   compiled_backtrack_limit, register_count};
+
+  SharedBytecodeCache* cache = GetSharedBytecodeCache();
+  base::MutexGuard guard(cache->mutex());
+  cache->Insert(std::move(key), std::move(entry));
+}
+
+// static
+size_t RegExpBytecodeCache::HitsForTesting() {
+  SharedBytecodeCache* cache = GetSharedBytecodeCache();
+  base::MutexGuard guard(cache->mutex());
+  return cache->hits();
+}
+
+}  // namespace internal
+}  // namespace v8
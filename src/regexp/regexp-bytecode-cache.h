@@ -0,0 +1,48 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include "src/handles/maybe-handles.h"
+#include "src/objects/js-regexp.h"
+
+namespace v8 {
+namespace internal {
+
+class ByteArray;
+
+// Process-wide cache of irregexp interpreter bytecode, shared by all isolates.
+// Bytecode is position independent and contains no heap references, so the
+// bytecode compiled for a pattern in one isolate can be copied into another
+// isolate instead of running the regexp compiler again.  Entries are keyed by
+// the pattern source, the flags, the subject encoding and the backtrack limit.
+// They are never evicted; once the cache has reached
+// --regexp-shared-bytecode-cache-size bytes, new bytecode is not added.
+class RegExpBytecodeCache final : public AllStatic {
+ public:
+  // Returns a copy of the cached bytecode in a new ByteArray, or an empty
+  // handle if there is none.  On success, `backtrack_limit` is updated to the
+  // limit the bytecode was compiled with and `register_count` is set.
+  static MaybeHandle<ByteArray> Lookup(Isolate* isolate, Handle<String> pattern,
+                                       JSRegExp::Flags flags, bool is_one_byte,
+                                       uint32_t* backtrack_limit,
+                                       int* register_count);
+
+  // Adds `bytecode`, compiled with the given inputs, to the cache.
+  // `compiled_backtrack_limit` and `register_count` are the values the
+  // compiler produced alongside the bytecode.
+  static void Insert(Handle<String> pattern, JSRegExp::Flags flags,
+                     bool is_one_byte, uint32_t backtrack_limit,
+                     ByteArray bytecode, uint32_t compiled_backtrack_limit,
+                     int register_count);
+
+  // Returns the number of successful lookups so far.
+  V8_EXPORT_PRIVATE static size_t HitsForTesting();
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
@@ -2888,6 +2888,13 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
     if (max_char_ > kSize) {
       masm->CheckCharacterAfterAnd(single_character,
                                    RegExpMacroAssembler::kTableMask, &cont);
+      // Landing on a position that the stepping loop below would skip is
+      // fine, since the character there may start a match.
+      if (masm->SkipUntilCharacterAfterAnd(max_lookahead, single_character,
+                                           RegExpMacroAssembler::kTableMask)) {
+        masm->Bind(&cont);
+        return;
+      }
     } else {
       masm->CheckCharacter(single_character, &cont);
     }
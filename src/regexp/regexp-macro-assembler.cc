@@ -4,6 +4,8 @@
 
 #include "src/regexp/regexp-macro-assembler.h"
 
+#include <cstring>
+
 #include "src/codegen/assembler.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/pointer-authentication.h"
@@ -134,6 +136,12 @@ bool RegExpMacroAssembler::CheckSpecialCharacterClass(uc16 type,
   return false;
 }
 
+bool RegExpMacroAssembler::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                      unsigned c,
+                                                      unsigned mask) {
+  return false;
+}
+
 NativeRegExpMacroAssembler::NativeRegExpMacroAssembler(Isolate* isolate,
                                                        Zone* zone)
     : RegExpMacroAssembler(isolate, zone) {}
@@ -395,5 +403,23 @@ Address NativeRegExpMacroAssembler::GrowStack(Address stack_pointer,
   return new_stack_base - stack_content_size;
 }
 
+// static
+Address NativeRegExpMacroAssembler::SkipUntilOneByteCharacter(Address start,
+                                                              Address end,
+                                                              int c) {
+  DCHECK_EQ(c & kTableMask, c);
+  DCHECK_LE(start, end);
+  // Both c and c | kTableSize pass the masked comparison.  memchr is
+  // vectorized by the C library, so two scans are still much faster than a
+  // byte-wise loop; the second one only covers the range before the first
+  // hit.
+  const void* found =
+      memchr(reinterpret_cast<const void*>(start), c, end - start);
+  Address limit = found != nullptr ? reinterpret_cast<Address>(found) : end;
+  found = memchr(reinterpret_cast<const void*>(start), c | kTableSize,
+                 limit - start);
+  return found != nullptr ? reinterpret_cast<Address>(found) : limit;
+}
+
 }  // namespace internal
 }  // namespace v8
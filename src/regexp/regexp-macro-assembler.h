@@ -123,6 +123,14 @@ class RegExpMacroAssembler {
   // not have custom support.
   // May clobber the current loaded character.
   virtual bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match);
+  // Advance the current position to the first position at or after it such
+  // that the character at cp_offset from it, masked with `mask`, equals `c`.
+  // If there is no such position, advance to the position where cp_offset is
+  // the end of the input.  Used to skip ahead in unanchored searches. Returns
+  // false, without emitting any code, if the backend has no fast path for
+  // this.  May clobber the current loaded character.
+  virtual bool SkipUntilCharacterAfterAnd(int cp_offset, unsigned c,
+                                          unsigned mask);
 
   // Control-flow integrity:
   // Define a jump target and bind a label.
@@ -273,6 +281,11 @@ class NativeRegExpMacroAssembler: public RegExpMacroAssembler {
   static Address GrowStack(Address stack_pointer, Address* stack_top,
                            Isolate* isolate);
 
+  // Returns the address of the first character in [start, end) that equals
+  // `c` when masked with kTableMask, or `end` if there is none.
+  // Called from generated RegExp code for one-byte subjects.
+  static Address SkipUntilOneByteCharacter(Address start, Address end, int c);
+
   static int CheckStackGuardState(Isolate* isolate, int start_index,
                                   RegExp::CallOrigin call_origin,
                                   Address* return_address, Code re_code,
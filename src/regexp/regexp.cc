@@ -9,6 +9,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -477,13 +478,31 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
   uint32_t backtrack_limit = re->BacktrackLimit();
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte, backtrack_limit);
-  if (!compilation_succeeded) {
-    DCHECK(compile_data.error != RegExpError::kNone);
-    RegExp::ThrowRegExpException(isolate, re, compile_data.error);
-    return false;
+  // Bytecode doesn't depend on the isolate, so another isolate may have
+  // compiled this pattern already.
+  Handle<ByteArray> cached_bytecode;
+  if (compile_data.compilation_target == RegExpCompilationTarget::kBytecode &&
+      RegExpBytecodeCache::Lookup(isolate, pattern, flags, is_one_byte,
+                                  &backtrack_limit,
+                                  &compile_data.register_count)
+          .ToHandle(&cached_bytecode)) {
+    compile_data.code = cached_bytecode;
+  } else {
+    const uint32_t requested_backtrack_limit = backtrack_limit;
+    const bool compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                is_one_byte, backtrack_limit);
+    if (!compilation_succeeded) {
+      DCHECK(compile_data.error != RegExpError::kNone);
+      RegExp::ThrowRegExpException(isolate, re, compile_data.error);
+      return false;
+    }
+    if (compile_data.compilation_target == RegExpCompilationTarget::kBytecode) {
+      RegExpBytecodeCache::Insert(pattern, flags, is_one_byte,
+                                  requested_backtrack_limit,
+                                  ByteArray::cast(*compile_data.code),
+                                  backtrack_limit, compile_data.register_count);
+    }
   }
 
   Handle<FixedArray> data =
@@ -969,15 +988,10 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
         num_matches_ = -1;  // Signal exception.
         return;
       }
-      if (regexp->ShouldProduceBytecode()) {
-        // Global loop in interpreted regexp is not implemented.  We choose the
-        // size of the offsets vector so that it can only store one match.
-        register_array_size_ = registers_per_match_;
-        max_matches_ = 1;
-      } else {
-        register_array_size_ = std::max(
-            {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
-      }
+      // Interpreted regexps have no global loop in the bytecode, but
+      // InterpretGlobal fills a batch of matches the same way.
+      register_array_size_ = std::max(
+          {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
       break;
     }
     case JSRegExp::EXPERIMENTAL: {
@@ -1033,6 +1047,29 @@ int RegExpGlobalCache::AdvanceZeroLength(int last_index) {
   return last_index + 1;
 }
 
+int RegExpGlobalCache::InterpretGlobal(int index) {
+  DCHECK(regexp_->ShouldProduceBytecode());
+  int num_matches = 0;
+  while (num_matches < max_matches_) {
+    int32_t* registers = &register_array_[num_matches * registers_per_match_];
+    int result = RegExpImpl::IrregexpExecRaw(isolate_, regexp_, subject_, index,
+                                             registers, registers_per_match_);
+    if (result == RegExp::RE_FAILURE) break;
+    // Exceptions and fallbacks discard the matches found so far in this batch.
+    if (result != RegExp::RE_SUCCESS) return result;
+    num_matches++;
+
+    int start_index = registers[0];
+    index = registers[1];
+    if (start_index == index) {
+      // Zero-length match. Advance by one code point.
+      index = AdvanceZeroLength(index);
+    }
+    if (index > subject_->length()) break;
+  }
+  return num_matches;
+}
+
 int32_t* RegExpGlobalCache::FetchNext() {
   current_match_index_++;
 
@@ -1074,9 +1111,13 @@ int32_t* RegExpGlobalCache::FetchNext() {
           num_matches_ = 0;  // Signal failed match.
           return nullptr;
         }
-        num_matches_ = RegExpImpl::IrregexpExecRaw(
-            isolate_, regexp_, subject_, last_end_index, register_array_,
-            register_array_size_);
+        if (regexp_->ShouldProduceBytecode()) {
+          num_matches_ = InterpretGlobal(last_end_index);
+        } else {
+          num_matches_ = RegExpImpl::IrregexpExecRaw(
+              isolate_, regexp_, subject_, last_end_index, register_array_,
+              register_array_size_);
+        }
         break;
       }
     }
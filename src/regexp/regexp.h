@@ -164,6 +164,11 @@ class RegExpGlobalCache final {
 
  private:
   int AdvanceZeroLength(int last_index);
+  // Runs the regexp interpreter repeatedly from `index` to fill the register
+  // array with up to max_matches_ consecutive matches, like the global loop
+  // of native irregexp code does.  Returns the number of matches or an error
+  // code.
+  int InterpretGlobal(int index);
 
   int num_matches_;
   int max_matches_;
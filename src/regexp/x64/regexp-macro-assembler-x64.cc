@@ -668,6 +668,56 @@ bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(uc16 type,
   }
 }
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                         unsigned c,
+                                                         unsigned mask) {
+  // Only one-byte subjects can be scanned with memchr.
+  if (mode_ != LATIN1 || mask != kTableMask || (c & ~mask) != 0) return false;
+
+  // Save important/volatile registers before calling C function.
+#ifndef V8_TARGET_OS_WIN
+  // Caller save on Linux and callee save in Windows.
+  __ pushq(rsi);
+  __ pushq(rdi);
+#endif
+  __ pushq(backtrack_stackpointer());
+
+  static const int num_arguments = 3;
+  __ PrepareCallCFunction(num_arguments);
+
+  // Put arguments into parameter registers. Parameters are
+  //   Address start - Address of the character at cp_offset.
+  //   Address end - End of input.
+  //   int c - Character to look for.
+  // Compute start before overwriting rsi and rdi on Linux.
+  __ leaq(rax, Operand(rsi, rdi, times_1, cp_offset));
+  __ movq(arg_reg_2, rsi);
+  __ movq(arg_reg_1, rax);
+  __ Set(arg_reg_3, c);
+
+  {  // NOLINT: Can't find a way to open this scope without confusing the
+     // linter.
+    AllowExternalCallThatCantCauseGC scope(&masm_);
+    ExternalReference skip =
+        ExternalReference::re_skip_until_one_byte_character();
+    __ CallCFunction(skip, num_arguments);
+  }
+
+  // Restore original values before using the result.
+  __ Move(code_object_pointer(), masm_.CodeObject());
+  __ popq(backtrack_stackpointer());
+#ifndef V8_TARGET_OS_WIN
+  __ popq(rdi);
+  __ popq(rsi);
+#endif
+
+  // rax is the address of the character found, or the end of input.  Convert
+  // it back into a current position.
+  __ subq(rax, rsi);
+  __ leaq(rdi, Operand(rax, -cp_offset));
+  return true;
+}
+
 
 void RegExpMacroAssemblerX64::Fail() {
   STATIC_ASSERT(FAILURE == 0);  // Return value for failure is zero.
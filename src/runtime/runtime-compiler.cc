@@ -235,6 +235,11 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   // Invalidate the underlying optimized code on eager and soft deopts.
   if (type == DeoptimizeKind::kEager || type == DeoptimizeKind::kSoft) {
     Deoptimizer::DeoptimizeFunction(*function, *optimized_code);
+    // A hotness hint that led to early optimization on incomplete feedback
+    // is dropped, so the next attempt waits for the regular tick count.
+    if (V8_UNLIKELY(FLAG_cache_hotness_hints)) {
+      function->shared().set_was_marked_hot(false);
+    }
   }
 
   return ReadOnlyRoots(isolate).undefined_value();
@@ -390,6 +395,21 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
     }
   }
 
+  if (FLAG_concurrent_osr && isolate->concurrent_recompilation_enabled() &&
+      isolate->optimizing_compile_dispatcher()->HasPendingOSRJob(function,
+                                                                 osr_offset)) {
+    // The code is compiled concurrently; keep running the loop in the
+    // interpreter until its back edge is re-armed.
+    if (FLAG_trace_osr) {
+      CodeTracer::Scope scope(isolate->GetCodeTracer());
+      PrintF(scope.file(), "[OSR - Queued: ");
+      function->PrintName(scope.file());
+      PrintF(scope.file(), " at OSR bytecode offset %d]\n",
+             osr_offset.ToInt());
+    }
+    return Object();
+  }
+
   // Failed.
   if (FLAG_trace_osr) {
     CodeTracer::Scope scope(isolate->GetCodeTracer());
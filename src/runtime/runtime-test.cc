@@ -542,7 +542,9 @@ RUNTIME_FUNCTION(Runtime_GetOptimizationStatus) {
 
   if (isolate->concurrent_recompilation_enabled() &&
       sync_with_compiler_thread) {
-    while (function->IsInOptimizationQueue()) {
+    while (function->IsInOptimizationQueue() ||
+           isolate->optimizing_compile_dispatcher()->HasPendingOSRJob(
+               function)) {
       isolate->optimizing_compile_dispatcher()->InstallOptimizedFunctions();
       base::OS::Sleep(base::TimeDelta::FromMilliseconds(50));
     }
@@ -5,7 +5,10 @@
 #include "src/snapshot/code-serializer.h"
 
 #include "src/base/platform/platform.h"
+#include "src/codegen/compilation-cache.h"
+#include "src/codegen/external-reference-encoder.h"
 #include "src/codegen/macro-assembler.h"
+#include "src/codegen/reloc-info.h"
 #include "src/common/globals.h"
 #include "src/debug/debug.h"
 #include "src/heap/heap-inl.h"
@@ -38,6 +41,113 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
 
+namespace {
+
+// Whether {object}, referenced from NCI code of {script}, deserializes into an
+// object that the code can use in place of the original: read-only objects,
+// internalized strings (which are canonicalized on deserialization), heap
+// numbers, and the compiled SharedFunctionInfos of {script} itself (which are
+// part of the serialized graph anyway).
+bool IsSerializableNCIConstant(HeapObject object, Script script) {
+  if (ReadOnlyHeap::Contains(object)) return true;
+  if (object.IsInternalizedString() || object.IsHeapNumber()) return true;
+  if (object.IsSharedFunctionInfo()) {
+    SharedFunctionInfo shared = SharedFunctionInfo::cast(object);
+    return shared.script() == script && shared.HasBytecodeArray() &&
+           !shared.HasDebugInfo();
+  }
+  return false;
+}
+
+// Whether {code}, the cached NCI code of {shared}, can be written to the code
+// cache of {script}. Code that refers to anything which does not survive the
+// round trip (non-builtin code targets, runtime entries, API callbacks,
+// context-specific constants, feedback vectors) is skipped.
+bool IsSerializableNCICode(Isolate* isolate, ExternalReferenceEncoder* encoder,
+                           Code code, SharedFunctionInfo shared,
+                           Script script) {
+  DisallowGarbageCollection no_gc;
+  if (code.kind() != CodeKind::NATIVE_CONTEXT_INDEPENDENT) return false;
+  if (code.marked_for_deoptimization()) return false;
+  if (!IsSerializableNCIConstant(shared, script)) return false;
+
+  const int mode_mask = RelocInfo::EmbeddedObjectModeMask() |
+                        RelocInfo::ModeMask(RelocInfo::CODE_TARGET) |
+                        RelocInfo::ModeMask(RelocInfo::RELATIVE_CODE_TARGET) |
+                        RelocInfo::ModeMask(RelocInfo::EXTERNAL_REFERENCE) |
+                        RelocInfo::ModeMask(RelocInfo::RUNTIME_ENTRY);
+  for (RelocIterator it(code, mode_mask); !it.done(); it.next()) {
+    RelocInfo* rinfo = it.rinfo();
+    RelocInfo::Mode mode = rinfo->rmode();
+    if (RelocInfo::IsRuntimeEntry(mode)) return false;
+    if (RelocInfo::IsCodeTargetMode(mode)) {
+      Code target = Code::GetCodeFromTargetAddress(rinfo->target_address());
+      if (!target.is_builtin()) return false;
+    } else if (RelocInfo::IsExternalReference(mode)) {
+      ExternalReferenceEncoder::Value value;
+      if (!encoder->TryEncode(rinfo->target_external_reference()).To(&value) ||
+          value.is_from_api()) {
+        return false;
+      }
+    } else if (!IsSerializableNCIConstant(
+                   HeapObject::cast(rinfo->target_object()), script)) {
+      return false;
+    }
+  }
+
+  FixedArray deopt_data = code.deoptimization_data();
+  if (deopt_data.length() == 0) return true;
+  DeoptimizationData data = DeoptimizationData::cast(deopt_data);
+  FixedArray literals = data.LiteralArray();
+  int inlined_function_count = data.InlinedFunctionCount().value();
+  for (int i = 0; i < literals.length(); ++i) {
+    Object literal = literals.get(i);
+    if (!literal.IsHeapObject()) continue;
+    if (literal.IsBytecodeArray()) {
+      // The bytecode of the function or of one of its inlinees, which comes
+      // first in the literal array.
+      bool found = shared.GetBytecodeArray(isolate) == literal;
+      for (int j = 0; !found && j < inlined_function_count; ++j) {
+        SharedFunctionInfo inlined = SharedFunctionInfo::cast(literals.get(j));
+        found = inlined.HasBytecodeArray() &&
+                inlined.GetBytecodeArray(isolate) == literal;
+      }
+      if (!found) return false;
+    } else if (!IsSerializableNCIConstant(HeapObject::cast(literal), script)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Collects the serializable NCI code of the functions in {script} from the
+// compilation cache, as a list of (SharedFunctionInfo, Code) pairs.
+Handle<FixedArray> CollectNCICode(Isolate* isolate, Handle<Script> script) {
+  ExternalReferenceEncoder encoder(isolate);
+  std::vector<std::pair<Handle<SharedFunctionInfo>, Handle<Code>>> entries;
+  SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+  for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    Handle<SharedFunctionInfo> shared(info, isolate);
+    Handle<Code> code;
+    if (!shared->TryGetCachedCode(isolate).ToHandle(&code)) continue;
+    if (!IsSerializableNCICode(isolate, &encoder, *code, *shared, *script)) {
+      continue;
+    }
+    entries.emplace_back(shared, code);
+  }
+
+  Handle<FixedArray> result = isolate->factory()->NewFixedArray(
+      static_cast<int>(2 * entries.size()), AllocationType::kOld);
+  for (size_t i = 0; i < entries.size(); ++i) {
+    result->set(static_cast<int>(2 * i), *entries[i].first);
+    result->set(static_cast<int>(2 * i + 1), *entries[i].second);
+  }
+  return result;
+}
+
+}  // namespace
+
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
     Handle<SharedFunctionInfo> info) {
@@ -63,11 +173,20 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   // Serialize code object.
   Handle<String> source(String::cast(script->source()), isolate);
   HandleScope scope(isolate);
+  Handle<FixedArray> nci_code;
+  if (FLAG_serialize_nci_code) nci_code = CollectNCICode(isolate, script);
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
                                  source, script->origin_options()));
   DisallowGarbageCollection no_gc;
   cs.reference_map()->AddAttachedReference(*source);
-  ScriptData* script_data = cs.SerializeSharedFunctionInfo(info);
+  if (FLAG_serialize_nci_code) {
+    // NCI code calls builtins through code targets. Encode them as attached
+    // references instead of copying them into the cache.
+    for (int i = 0; i < Builtins::builtin_count; i++) {
+      cs.reference_map()->AddAttachedReference(isolate->builtins()->builtin(i));
+    }
+  }
+  ScriptData* script_data = cs.SerializeSharedFunctionInfo(info, nci_code);
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -85,11 +204,15 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
 }
 
 ScriptData* CodeSerializer::SerializeSharedFunctionInfo(
-    Handle<SharedFunctionInfo> info) {
+    Handle<SharedFunctionInfo> info, Handle<FixedArray> nci_code) {
   DisallowGarbageCollection no_gc;
 
   VisitRootPointer(Root::kHandleScope, nullptr,
                    FullObjectSlot(info.location()));
+  if (FLAG_serialize_nci_code) {
+    VisitRootPointer(Root::kHandleScope, nullptr,
+                     FullObjectSlot(nci_code.location()));
+  }
   SerializeDeferredObjects();
   Pad();
 
@@ -128,13 +251,30 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
 
   if (SerializeReadOnlyObject(obj)) return;
 
-  CHECK(!obj->IsCode());
+  // Builtins are attached references. The only other code we see is the NCI
+  // code collected by CollectNCICode.
+  CHECK_IMPLIES(obj->IsCode(),
+                FLAG_serialize_nci_code &&
+                    Code::cast(*obj).kind() ==
+                        CodeKind::NATIVE_CONTEXT_INDEPENDENT);
 
   ReadOnlyRoots roots(isolate());
   if (ElideObject(*obj)) {
     return SerializeObject(roots.undefined_value_handle());
   }
 
+  if (obj->IsCodeDataContainer()) {
+    // Don't serialize the list of optimized code of the native context that
+    // the NCI code was compiled in.
+    Handle<CodeDataContainer> container =
+        Handle<CodeDataContainer>::cast(obj);
+    Object next_code_link = container->next_code_link();
+    container->set_next_code_link(roots.undefined_value());
+    SerializeGeneric(obj);
+    container->set_next_code_link(next_code_link, UPDATE_WEAK_WRITE_BARRIER);
+    return;
+  }
+
   if (obj->IsScript()) {
     Handle<Script> script_obj = Handle<Script>::cast(obj);
     DCHECK_NE(script_obj->compilation_type(), Script::COMPILATION_TYPE_EVAL);
@@ -380,6 +520,10 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
             SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate,
                                                                shared_info);
           }
+          Handle<Code> nci_code;
+          if (FLAG_serialize_nci_code) {
+            shared_info->TryGetCachedCode(isolate).ToHandle(&nci_code);
+          }
           DisallowGarbageCollection no_gc;
           int line_num =
               script->GetLineNumber(shared_info->StartPosition()) + 1;
@@ -390,6 +534,14 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
                       CodeEventListener::SCRIPT_TAG,
                       handle(shared_info->abstract_code(isolate), isolate),
                       shared_info, name, line_num, column_num));
+          if (!nci_code.is_null()) {
+            PROFILE(isolate,
+                    CodeCreateEvent(
+                        Logger::ToNativeByScript(
+                            CodeEventListener::LAZY_COMPILE_TAG, *script),
+                        Handle<AbstractCode>::cast(nci_code), shared_info,
+                        name, line_num, column_num));
+          }
         }
       }
     }
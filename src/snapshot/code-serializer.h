@@ -51,7 +51,12 @@ class CodeSerializer : public Serializer {
   V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
       Handle<SharedFunctionInfo> info);
 
-  ScriptData* SerializeSharedFunctionInfo(Handle<SharedFunctionInfo> info);
+  // With --serialize-nci-code, {nci_code} is serialized after {info} as a
+  // second root. It holds (SharedFunctionInfo, Code) pairs of native context
+  // independent code that is installed into the compilation cache again on
+  // deserialization.
+  ScriptData* SerializeSharedFunctionInfo(Handle<SharedFunctionInfo> info,
+                                          Handle<FixedArray> nci_code);
 
   V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo> Deserialize(
       Isolate* isolate, ScriptData* cached_data, Handle<String> source,
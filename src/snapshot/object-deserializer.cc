@@ -4,9 +4,13 @@
 
 #include "src/snapshot/object-deserializer.h"
 
+#include "src/base/optional.h"
 #include "src/codegen/assembler-inl.h"
+#include "src/codegen/compilation-cache.h"
+#include "src/codegen/flush-instruction-cache.h"
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/heap-write-barrier-inl.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/objects.h"
 #include "src/objects/slots.h"
@@ -26,6 +30,11 @@ ObjectDeserializer::DeserializeSharedFunctionInfo(
   ObjectDeserializer d(isolate, data);
 
   d.AddAttachedObject(source);
+  if (FLAG_serialize_nci_code) {
+    for (int i = 0; i < Builtins::builtin_count; i++) {
+      d.AddAttachedObject(isolate->builtins()->builtin_handle(i));
+    }
+  }
 
   Handle<HeapObject> result;
   return d.Deserialize().ToHandle(&result)
@@ -45,10 +54,18 @@ MaybeHandle<HeapObject> ObjectDeserializer::Deserialize() {
   DCHECK(deserializing_user_code());
   HandleScope scope(isolate());
   Handle<HeapObject> result;
+  Handle<FixedArray> nci_code;
   {
+    // NCI code objects are written to after they have been allocated.
+    base::Optional<CodePageCollectionMemoryModificationScope> code_modification;
+    if (FLAG_serialize_nci_code) code_modification.emplace(isolate()->heap());
     result = ReadObject();
+    if (FLAG_serialize_nci_code) {
+      nci_code = Handle<FixedArray>::cast(ReadObject());
+    }
     DeserializeDeferredObjects();
-    CHECK(new_code_objects().empty());
+    CHECK_IMPLIES(!FLAG_serialize_nci_code, new_code_objects().empty());
+    FlushICache();
     LinkAllocationSites();
     CHECK(new_maps().empty());
     WeakenDescriptorArrays();
@@ -56,9 +73,37 @@ MaybeHandle<HeapObject> ObjectDeserializer::Deserialize() {
 
   Rehash();
   CommitPostProcessedObjects();
+  if (!nci_code.is_null()) InstallNCICode(nci_code);
   return scope.CloseAndEscape(result);
 }
 
+void ObjectDeserializer::FlushICache() {
+  DCHECK(deserializing_user_code());
+  for (Handle<Code> code : new_code_objects()) {
+    // Record all references to embedded objects in the new code object.
+#ifndef V8_DISABLE_WRITE_BARRIERS
+    WriteBarrierForCode(*code);
+#endif
+    FlushInstructionCache(code->raw_instruction_start(),
+                          code->raw_instruction_size());
+  }
+}
+
+void ObjectDeserializer::InstallNCICode(Handle<FixedArray> nci_code) {
+  DCHECK(FLAG_serialize_nci_code);
+  for (int i = 0; i < nci_code->length(); i += 2) {
+    Handle<SharedFunctionInfo> shared(
+        SharedFunctionInfo::cast(nci_code->get(i)), isolate());
+    Handle<Code> code(Code::cast(nci_code->get(i + 1)), isolate());
+    DCHECK_EQ(code->kind(), CodeKind::NATIVE_CONTEXT_INDEPENDENT);
+    isolate()->compilation_cache()->PutCode(shared, code);
+    shared->set_may_have_cached_code(true);
+    if (FLAG_trace_turbo_nci) {
+      CompilationCacheCode::TraceInsertion(shared, code);
+    }
+  }
+}
+
 void ObjectDeserializer::CommitPostProcessedObjects() {
   for (Handle<JSArrayBuffer> buffer : new_off_heap_array_buffers()) {
     uint32_t store_index = buffer->GetBackingStoreRefForDeserialization();
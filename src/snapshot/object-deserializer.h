@@ -28,8 +28,12 @@ class ObjectDeserializer final : public Deserializer {
   // Deserialize an object graph. Fail gracefully.
   MaybeHandle<HeapObject> Deserialize();
 
+  void FlushICache();
   void LinkAllocationSites();
   void CommitPostProcessedObjects();
+  // Puts the (SharedFunctionInfo, Code) pairs of {nci_code} into the
+  // compilation cache.
+  void InstallNCICode(Handle<FixedArray> nci_code);
 };
 
 }  // namespace internal
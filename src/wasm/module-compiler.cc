@@ -25,6 +25,7 @@
 #include "src/trap-handler/trap-handler.h"
 #include "src/utils/identity-map.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
@@ -990,6 +991,18 @@ class CompilationUnitBuilder {
     tiering_units_.emplace_back(func_index, tiers.top_tier, kNoDebugging);
   }
 
+  void AddPrefetchUnits(int func_index) {
+    ExecutionTierPair tiers = GetRequestedExecutionTiers(
+        native_module_->module(), compilation_state()->compile_mode(),
+        native_module_->enabled_features(), func_index);
+    // Mirror {CompileLazy}: a lazily compiled function is tiered up right
+    // after its baseline code exists, so queue the top tier unit as well.
+    baseline_units_.emplace_back(func_index, tiers.baseline_tier, kNoDebugging);
+    if (tiers.baseline_tier < tiers.top_tier) {
+      tiering_units_.emplace_back(func_index, tiers.top_tier, kNoDebugging);
+    }
+  }
+
   void AddRecompilationUnit(int func_index, ExecutionTier tier) {
     // For recompilation, just treat all units like baseline units.
     baseline_units_.emplace_back(
@@ -1111,6 +1124,10 @@ bool CompileLazy(Isolate* isolate, Handle<WasmModuleObject> module_object,
 
   TRACE_LAZY("Compiling wasm-function#%d.\n", func_index);
 
+  if (FLAG_wasm_pgo_to_file) {
+    native_module->RecordLazilyCompiledFunction(func_index);
+  }
+
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
   ExecutionTierPair tiers = GetRequestedExecutionTiers(
@@ -1411,6 +1428,12 @@ void InitializeCompilationUnits(Isolate* isolate, NativeModule* native_module) {
   auto* module = native_module->module();
   const bool prefer_liftoff = native_module->IsTieredDown();
 
+  std::unique_ptr<ProfileInformation> pgo_info;
+  if (FLAG_wasm_pgo_from_file && !prefer_liftoff) {
+    pgo_info = LoadProfileFromFile(module, native_module->wire_bytes());
+  }
+  std::vector<bool> prefetch;
+
   uint32_t start = module->num_imported_functions;
   uint32_t end = start + module->num_declared_functions;
   for (uint32_t func_index = start; func_index < end; func_index++) {
@@ -1422,6 +1445,10 @@ void InitializeCompilationUnits(Isolate* isolate, NativeModule* native_module) {
         module, native_module->enabled_features(), func_index, lazy_module);
     if (strategy == CompileStrategy::kLazy) {
       native_module->UseLazyStub(func_index);
+      if (pgo_info) {
+        if (prefetch.empty()) prefetch.resize(module->num_declared_functions);
+        prefetch[declared_function_index(module, func_index)] = true;
+      }
     } else if (strategy == CompileStrategy::kLazyBaselineEagerTopTier) {
       builder.AddTopTierUnit(func_index);
       native_module->UseLazyStub(func_index);
@@ -1430,6 +1457,24 @@ void InitializeCompilationUnits(Isolate* isolate, NativeModule* native_module) {
       builder.AddUnits(func_index);
     }
   }
+  // Compile the lazy functions which were executed in the profiled run in the
+  // background, in the order of their first execution. They still start out
+  // with the lazy stub, so a call before their code is published compiles
+  // them on the main thread as usual. These units do not contribute to
+  // baseline compilation progress.
+  if (!prefetch.empty()) {
+    for (uint32_t func_index : pgo_info->executed_functions()) {
+      int slot_index = declared_function_index(module, func_index);
+      if (!prefetch[slot_index]) continue;
+      prefetch[slot_index] = false;
+      builder.AddPrefetchUnits(func_index);
+      // A prefetched function never reaches {CompileLazy}, so record it here
+      // to keep it in the profile written for the next run.
+      if (FLAG_wasm_pgo_to_file) {
+        native_module->RecordLazilyCompiledFunction(func_index);
+      }
+    }
+  }
   int num_import_wrappers = AddImportWrapperUnits(native_module, &builder);
   int num_export_wrappers =
       AddExportWrapperUnits(isolate, isolate->wasm_engine(), native_module,
@@ -1654,8 +1699,8 @@ std::shared_ptr<NativeModule> CompileToNativeModule(
       isolate->wasm_engine()->MaybeGetNativeModule(
           wasm_module->origin, wire_bytes_copy.as_vector(), isolate);
   if (native_module) {
-    // TODO(thibaudm): Look into sharing export wrappers.
-    CompileJsToWasmWrappers(isolate, wasm_module, export_wrappers_out);
+    GetOrCompileJsToWasmWrappers(isolate, native_module.get(),
+                                 export_wrappers_out);
     return native_module;
   }
 
@@ -1688,7 +1733,8 @@ std::shared_ptr<NativeModule> CompileToNativeModule(
   if (thrower->error()) return {};
 
   if (cache_hit) {
-    CompileJsToWasmWrappers(isolate, wasm_module, export_wrappers_out);
+    GetOrCompileJsToWasmWrappers(isolate, native_module.get(),
+                                 export_wrappers_out);
     return native_module;
   }
 
@@ -1952,8 +1998,8 @@ void AsyncCompileJob::FinishCompile(bool is_after_cache_hit) {
   if (!is_after_deserialization) {
     Handle<FixedArray> export_wrappers;
     if (is_after_cache_hit) {
-      // TODO(thibaudm): Look into sharing wrappers.
-      CompileJsToWasmWrappers(isolate_, module, &export_wrappers);
+      GetOrCompileJsToWasmWrappers(isolate_, native_module_.get(),
+                                   &export_wrappers);
     } else {
       compilation_state->FinalizeJSToWasmWrappers(isolate_, module,
                                                   &export_wrappers);
@@ -3455,6 +3501,20 @@ void CompileJsToWasmWrappers(Isolate* isolate, const WasmModule* module,
   }
 }
 
+void GetOrCompileJsToWasmWrappers(Isolate* isolate,
+                                  NativeModule* native_module,
+                                  Handle<FixedArray>* export_wrappers_out) {
+  if (isolate->wasm_engine()
+          ->MaybeGetExportWrappers(isolate, native_module)
+          .ToHandle(export_wrappers_out)) {
+    DCHECK_EQ(MaxNumExportWrappers(native_module->module()),
+              (*export_wrappers_out)->length());
+    return;
+  }
+  CompileJsToWasmWrappers(isolate, native_module->module(),
+                          export_wrappers_out);
+}
+
 WasmCode* CompileImportWrapper(
     WasmEngine* wasm_engine, NativeModule* native_module, Counters* counters,
     compiler::WasmImportCallKind kind, const FunctionSig* sig,
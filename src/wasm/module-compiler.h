@@ -52,6 +52,12 @@ V8_EXPORT_PRIVATE
 void CompileJsToWasmWrappers(Isolate* isolate, const WasmModule* module,
                              Handle<FixedArray>* export_wrappers_out);
 
+// Reuses the export wrappers of an existing instance of {native_module} in
+// {isolate} if possible, and compiles them otherwise.
+void GetOrCompileJsToWasmWrappers(Isolate* isolate,
+                                  NativeModule* native_module,
+                                  Handle<FixedArray>* export_wrappers_out);
+
 // Compiles the wrapper for this (kind, sig) pair and sets the corresponding
 // cache entry. Assumes the key already exists in the cache but has not been
 // compiled yet.
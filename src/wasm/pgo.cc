@@ -0,0 +1,103 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/pgo.h"
+
+#include <unordered_set>
+
+#include "src/base/functional.h"
+#include "src/flags/flags.h"
+#include "src/utils/ostreams.h"
+#include "src/utils/utils.h"
+#include "src/wasm/decoder.h"
+#include "src/wasm/leb-helper.h"
+#include "src/wasm/wasm-module.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+namespace {
+
+// The profile format is:
+//   u32v  number of declared functions (used for validation)
+//   u32v  number of executed functions {n}
+//   n x u32v  executed function indexes, in order of first execution
+EmbeddedVector<char, 32> GetProfileFileName(Vector<const uint8_t> wire_bytes) {
+  size_t hash = base::hash_range(wire_bytes.begin(), wire_bytes.end());
+  EmbeddedVector<char, 32> filename;
+  SNPrintF(filename, "profile-wasm-%016zx", hash);
+  return filename;
+}
+
+void WriteU32V(std::vector<uint8_t>* buffer, uint32_t value) {
+  size_t pos = buffer->size();
+  buffer->resize(pos + LEBHelper::sizeof_u32v(value));
+  uint8_t* dest = buffer->data() + pos;
+  LEBHelper::write_u32v(&dest, value);
+  DCHECK_EQ(buffer->data() + buffer->size(), dest);
+}
+
+}  // namespace
+
+void DumpProfileToFile(const WasmModule* module,
+                       Vector<const uint8_t> wire_bytes,
+                       const std::vector<uint32_t>& executed_functions) {
+  std::vector<uint32_t> unique_functions;
+  unique_functions.reserve(executed_functions.size());
+  std::unordered_set<uint32_t> seen;
+  for (uint32_t func_index : executed_functions) {
+    if (seen.insert(func_index).second) unique_functions.push_back(func_index);
+  }
+
+  std::vector<uint8_t> buffer;
+  WriteU32V(&buffer, module->num_declared_functions);
+  WriteU32V(&buffer, static_cast<uint32_t>(unique_functions.size()));
+  for (uint32_t func_index : unique_functions) WriteU32V(&buffer, func_index);
+
+  EmbeddedVector<char, 32> filename = GetProfileFileName(wire_bytes);
+  if (FLAG_trace_wasm_lazy_compilation) {
+    PrintF("Dumping Wasm PGO data to file '%s' (%zu functions)\n",
+           filename.begin(), unique_functions.size());
+  }
+  WriteBytes(filename.begin(), buffer.data(), static_cast<int>(buffer.size()));
+}
+
+std::unique_ptr<ProfileInformation> LoadProfileFromFile(
+    const WasmModule* module, Vector<const uint8_t> wire_bytes) {
+  EmbeddedVector<char, 32> filename = GetProfileFileName(wire_bytes);
+  bool exists = false;
+  constexpr bool kVerbose = false;
+  std::string data = ReadFile(filename.begin(), &exists, kVerbose);
+  if (!exists) return {};
+
+  const byte* start = reinterpret_cast<const byte*>(data.data());
+  Decoder decoder(start, start + data.size());
+  uint32_t num_declared_functions = decoder.consume_u32v("num functions");
+  // A hash collision or a stale file: ignore the profile.
+  if (num_declared_functions != module->num_declared_functions) return {};
+  uint32_t num_executed = decoder.consume_u32v("num executed functions");
+  if (num_executed > num_declared_functions) return {};
+
+  std::vector<uint32_t> executed_functions;
+  executed_functions.reserve(num_executed);
+  uint32_t start_index = module->num_imported_functions;
+  uint32_t end_index = start_index + num_declared_functions;
+  for (uint32_t i = 0; i < num_executed && decoder.ok(); ++i) {
+    uint32_t func_index = decoder.consume_u32v("function index");
+    if (func_index < start_index || func_index >= end_index) return {};
+    executed_functions.push_back(func_index);
+  }
+  if (decoder.failed() || decoder.more()) return {};
+
+  if (FLAG_trace_wasm_lazy_compilation) {
+    PrintF("Loaded Wasm PGO data from file '%s' (%zu functions)\n",
+           filename.begin(), executed_functions.size());
+  }
+  return std::make_unique<ProfileInformation>(std::move(executed_functions));
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
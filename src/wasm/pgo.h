@@ -0,0 +1,54 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_WASM_PGO_H_
+#define V8_WASM_PGO_H_
+
+#include <memory>
+#include <vector>
+
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+struct WasmModule;
+
+// Profile of a previous run of a module: the declared functions that were
+// lazily compiled (i.e. executed), in the order of their first execution.
+class ProfileInformation {
+ public:
+  explicit ProfileInformation(std::vector<uint32_t> executed_functions)
+      : executed_functions_(std::move(executed_functions)) {}
+
+  ProfileInformation(const ProfileInformation&) = delete;
+  ProfileInformation& operator=(const ProfileInformation&) = delete;
+
+  const std::vector<uint32_t>& executed_functions() const {
+    return executed_functions_;
+  }
+
+ private:
+  const std::vector<uint32_t> executed_functions_;
+};
+
+// Writes {executed_functions} to a file named "profile-wasm-<hash>", where the
+// hash is computed over {wire_bytes}. Duplicate entries are dropped, keeping
+// the first occurrence. Used with --wasm-pgo-to-file.
+void DumpProfileToFile(const WasmModule* module,
+                       Vector<const uint8_t> wire_bytes,
+                       const std::vector<uint32_t>& executed_functions);
+
+// Reads the profile written by {DumpProfileToFile} for the same wire bytes.
+// Returns nullptr if no profile exists or if it does not match {module}. Used
+// with --wasm-pgo-from-file.
+std::unique_ptr<ProfileInformation> LoadProfileFromFile(
+    const WasmModule* module, Vector<const uint8_t> wire_bytes);
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WASM_PGO_H_
@@ -27,6 +27,7 @@
 #include "src/wasm/function-compiler.h"
 #include "src/wasm/jump-table-assembler.h"
 #include "src/wasm/module-compiler.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-import-wrapper-cache.h"
 #include "src/wasm/wasm-module-sourcemap.h"
@@ -1016,6 +1017,13 @@ void NativeModule::UseLazyStub(uint32_t func_index) {
   PatchJumpTablesLocked(slot_index, lazy_compile_target);
 }
 
+void NativeModule::RecordLazilyCompiledFunction(uint32_t func_index) {
+  DCHECK(FLAG_wasm_pgo_to_file);
+  DCHECK_LE(module_->num_imported_functions, func_index);
+  base::MutexGuard guard(&allocation_mutex_);
+  lazily_compiled_functions_.push_back(func_index);
+}
+
 std::unique_ptr<WasmCode> NativeModule::AddCode(
     int index, const CodeDesc& desc, int stack_slots,
     int tagged_parameter_slots, Vector<const byte> protected_instructions_data,
@@ -1618,6 +1626,9 @@ NativeModule::~NativeModule() {
   // Cancel all background compilation before resetting any field of the
   // NativeModule or freeing anything.
   compilation_state_->CancelCompilation();
+  if (FLAG_wasm_pgo_to_file) {
+    DumpProfileToFile(module_.get(), wire_bytes(), lazily_compiled_functions_);
+  }
   engine_->FreeNativeModule(this);
   // Free the import wrapper cache before releasing the {WasmCode} objects in
   // {owned_code_}. The destructor of {WasmImportWrapperCache} still needs to
@@ -526,6 +526,12 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // table with trampolines accordingly.
   void UseLazyStub(uint32_t func_index);
 
+  // Records that {func_index} was lazily compiled, either because it was called
+  // for the first time or because a loaded profile prefetched it. The recorded
+  // order is written out as a compilation profile when the module dies (see
+  // --wasm-pgo-to-file).
+  void RecordLazilyCompiledFunction(uint32_t func_index);
+
   // Creates a snapshot of the current state of the code table. This is useful
   // to get a consistent view of the table (e.g. used by the serializer).
   std::vector<WasmCode*> SnapshotCodeTable() const;
@@ -612,6 +618,7 @@ class V8_EXPORT_PRIVATE NativeModule final {
   size_t generated_code_size() const {
     return code_allocator_.generated_code_size();
   }
+  size_t freed_code_size() const { return code_allocator_.freed_code_size(); }
   size_t liftoff_bailout_count() const { return liftoff_bailout_count_.load(); }
   size_t liftoff_code_size() const { return liftoff_code_size_.load(); }
   size_t turbofan_code_size() const { return turbofan_code_size_.load(); }
@@ -818,6 +825,10 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   TieringState tiering_state_ = kTieredUp;
 
+  // Declared functions in the order in which they were lazily compiled. Only
+  // populated with --wasm-pgo-to-file.
+  std::vector<uint32_t> lazily_compiled_functions_;
+
   // End of fields protected by {allocation_mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
@@ -830,7 +830,7 @@ Handle<WasmModuleObject> WasmEngine::ImportNativeModule(
   Handle<Script> script =
       GetOrCreateScript(isolate, shared_native_module, source_url);
   Handle<FixedArray> export_wrappers;
-  CompileJsToWasmWrappers(isolate, native_module->module(), &export_wrappers);
+  GetOrCompileJsToWasmWrappers(isolate, native_module, &export_wrappers);
   Handle<WasmModuleObject> module_object = WasmModuleObject::New(
       isolate, std::move(shared_native_module), script, export_wrappers);
   {
@@ -858,7 +858,12 @@ void WasmEngine::DumpAndResetTurboStatistics() {
   base::MutexGuard guard(&mutex_);
   if (compilation_stats_ != nullptr) {
     StdoutStream os;
-    os << AsPrintableStatistics{*compilation_stats_.get(), false} << std::endl;
+    if (FLAG_turbo_stats_json) {
+      os << AsJSONStatistics{*compilation_stats_.get()} << std::endl;
+    } else {
+      os << AsPrintableStatistics{*compilation_stats_.get(), false}
+         << std::endl;
+    }
   }
   compilation_stats_.reset();
 }
@@ -1258,6 +1263,7 @@ void WasmEngine::ReportLiveCodeForGC(Isolate* isolate,
   isolate->counters()->wasm_module_num_triggered_code_gcs()->AddSample(
       current_gc_info_->gc_sequence_index);
   for (WasmCode* code : live_code) current_gc_info_->dead_code.erase(code);
+  FreeDeadCodeOfFinishedModules();
   PotentiallyFinishCurrentGC();
 }
 
@@ -1366,6 +1372,32 @@ Handle<Script> WasmEngine::GetOrCreateScript(
   }
 }
 
+MaybeHandle<FixedArray> WasmEngine::MaybeGetExportWrappers(
+    Isolate* isolate, NativeModule* native_module) {
+  Handle<Script> script;
+  {
+    base::MutexGuard guard(&mutex_);
+    DCHECK_EQ(1, isolates_.count(isolate));
+    auto& scripts = isolates_[isolate]->scripts;
+    auto it = scripts.find(native_module);
+    if (it == scripts.end()) return {};
+    Handle<Script> weak_global_handle = it->second.handle();
+    if (weak_global_handle.is_null()) return {};
+    script = Handle<Script>::New(*weak_global_handle, isolate);
+  }
+  // All instances registered on the script belong to module objects of the
+  // same {NativeModule}, so any of them holds a complete set of wrappers.
+  WeakArrayList weak_instance_list = script->wasm_weak_instance_list();
+  for (int i = 0; i < weak_instance_list.length(); ++i) {
+    MaybeObject maybe_instance = weak_instance_list.Get(i);
+    if (!maybe_instance->IsWeak()) continue;
+    WasmInstanceObject instance =
+        WasmInstanceObject::cast(maybe_instance->GetHeapObjectAssumeWeak());
+    return handle(instance.module_object().export_wrappers(), isolate);
+  }
+  return {};
+}
+
 std::shared_ptr<OperationsBarrier>
 WasmEngine::GetBarrierForBackgroundCompile() {
   return operations_barrier_;
@@ -1413,6 +1445,64 @@ bool WasmEngine::RemoveIsolateFromCurrentGC(Isolate* isolate) {
   return current_gc_info_->outstanding_isolates.erase(isolate) != 0;
 }
 
+bool WasmEngine::MarkCodeAsDead(WasmCode* code, DeadCodeMap* dead_code) {
+  DCHECK(!mutex_.TryLock());
+  DCHECK_EQ(1, native_modules_.count(code->native_module()));
+  auto* native_module_info = native_modules_[code->native_module()].get();
+  DCHECK_EQ(1, native_module_info->potentially_dead_code.count(code));
+  native_module_info->potentially_dead_code.erase(code);
+  DCHECK_EQ(0, native_module_info->dead_code.count(code));
+  native_module_info->dead_code.insert(code);
+  if (!code->DecRefOnDeadCode()) return false;
+  (*dead_code)[code->native_module()].push_back(code);
+  return true;
+}
+
+void WasmEngine::FreeDeadCodeOfFinishedModules() {
+  DCHECK(!mutex_.TryLock());
+  DCHECK_NOT_NULL(current_gc_info_);
+  // If no isolate is outstanding any more, {PotentiallyFinishCurrentGC} frees
+  // everything at once.
+  if (current_gc_info_->outstanding_isolates.empty()) return;
+
+  // A native module is finished if none of its isolates is still outstanding.
+  // Superseded code of such a module cannot be on any stack, so it can be
+  // released right away instead of staying resident until the slowest isolate
+  // (possibly running an unrelated module) reports.
+  std::unordered_map<NativeModule*, bool> module_finished;
+  auto is_finished = [this, &module_finished](NativeModule* native_module) {
+    auto it = module_finished.find(native_module);
+    if (it != module_finished.end()) return it->second;
+    bool finished = true;
+    for (Isolate* isolate : native_modules_[native_module]->isolates) {
+      if (current_gc_info_->outstanding_isolates.count(isolate)) {
+        finished = false;
+        break;
+      }
+    }
+    module_finished.emplace(native_module, finished);
+    return finished;
+  };
+
+  size_t num_freed = 0;
+  DeadCodeMap dead_code;
+  auto& gc_dead_code = current_gc_info_->dead_code;
+  for (auto it = gc_dead_code.begin(); it != gc_dead_code.end();) {
+    WasmCode* code = *it;
+    if (!is_finished(code->native_module())) {
+      ++it;
+      continue;
+    }
+    if (MarkCodeAsDead(code, &dead_code)) ++num_freed;
+    it = gc_dead_code.erase(it);
+  }
+  if (dead_code.empty()) return;
+
+  FreeDeadCodeLocked(dead_code);
+  TRACE_CODE_GC("Freed %zu dead code objects of %zu finished modules early.\n",
+                num_freed, dead_code.size());
+}
+
 void WasmEngine::PotentiallyFinishCurrentGC() {
   DCHECK(!mutex_.TryLock());
   TRACE_CODE_GC(
@@ -1429,16 +1519,7 @@ void WasmEngine::PotentiallyFinishCurrentGC() {
   size_t num_freed = 0;
   DeadCodeMap dead_code;
   for (WasmCode* code : current_gc_info_->dead_code) {
-    DCHECK_EQ(1, native_modules_.count(code->native_module()));
-    auto* native_module_info = native_modules_[code->native_module()].get();
-    DCHECK_EQ(1, native_module_info->potentially_dead_code.count(code));
-    native_module_info->potentially_dead_code.erase(code);
-    DCHECK_EQ(0, native_module_info->dead_code.count(code));
-    native_module_info->dead_code.insert(code);
-    if (code->DecRefOnDeadCode()) {
-      dead_code[code->native_module()].push_back(code);
-      ++num_freed;
-    }
+    if (MarkCodeAsDead(code, &dead_code)) ++num_freed;
   }
 
   FreeDeadCodeLocked(dead_code);
@@ -335,6 +335,12 @@ class V8_EXPORT_PRIVATE WasmEngine {
                                    const std::shared_ptr<NativeModule>&,
                                    Vector<const char> source_url);
 
+  // Returns the export wrappers of a live instance of {native_module} in
+  // {isolate}, if there is one. This allows module objects which share a
+  // {NativeModule} (e.g. after a native module cache hit) to share their
+  // JS-to-Wasm wrappers instead of compiling them again.
+  MaybeHandle<FixedArray> MaybeGetExportWrappers(Isolate*, NativeModule*);
+
   // Returns a barrier allowing background compile operations if valid and
   // preventing this object from being destroyed.
   std::shared_ptr<OperationsBarrier> GetBarrierForBackgroundCompile();
@@ -366,6 +372,16 @@ class V8_EXPORT_PRIVATE WasmEngine {
   // when calling this method.
   bool RemoveIsolateFromCurrentGC(Isolate*);
 
+  // Free the dead code of all native modules whose isolates have all reported
+  // their live code already, without waiting for the remaining isolates of the
+  // current GC. Hold {mutex_} when calling this method.
+  void FreeDeadCodeOfFinishedModules();
+
+  // Move {code} from the potentially dead code of its native module to the dead
+  // code, and add it to {dead_code} if its ref count dropped to zero. Returns
+  // whether the code was added. Hold {mutex_} when calling this method.
+  bool MarkCodeAsDead(WasmCode* code, DeadCodeMap* dead_code);
+
   // Finish a GC if there are no more outstanding isolates. Hold {mutex_} when
   // calling this method.
   void PotentiallyFinishCurrentGC();
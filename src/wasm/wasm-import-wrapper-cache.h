@@ -32,8 +32,11 @@ class WasmImportWrapperCache {
                              ? 0
                              : _expected_arity) {}
 
+    // Signatures are compared structurally, so that wrappers are shared
+    // between all imports with an equal signature, even if the module
+    // declares the same function type several times.
     bool operator==(const CacheKey& rhs) const {
-      return kind == rhs.kind && signature == rhs.signature &&
+      return kind == rhs.kind && *signature == *rhs.signature &&
              expected_arity == rhs.expected_arity;
     }
 
@@ -45,8 +48,8 @@ class WasmImportWrapperCache {
   class CacheKeyHash {
    public:
     size_t operator()(const CacheKey& key) const {
-      return base::hash_combine(static_cast<uint8_t>(key.kind), key.signature,
-                                key.expected_arity);
+      return base::hash_combine(static_cast<uint8_t>(key.kind),
+                                hash_value(*key.signature), key.expected_arity);
     }
   };
 
@@ -0,0 +1,167 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Per-op throughput of Wasm SIMD instructions. Each benchmark runs one op in
+// a loop of {kIterationsPerCall} iterations, once compiled by Liftoff (arg 0)
+// and once by TurboFan (arg 1), so the codegen of both tiers can be tracked.
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8.h"
+#include "src/wasm/wasm-module-builder.h"
+#include "src/wasm/wasm-opcodes.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+#include "test/common/wasm/test-signatures.h"
+#include "test/common/wasm/wasm-macro-gen.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+namespace {
+
+constexpr int32_t kIterationsPerCall = 1024;
+
+enum Tier : int64_t { kLiftoff = 0, kTurbofan = 1 };
+
+enum class OpShape { kUnop, kBinop, kShiftByConstant, kShiftByRegister };
+
+void InitializeV8Once() {
+  static v8::Platform* platform = [] {
+    v8::V8::SetFlagsFromString("--experimental-wasm-simd");
+    v8::Platform* platform = v8::platform::NewDefaultPlatform().release();
+    v8::V8::InitializePlatform(platform);
+    v8::V8::Initialize();
+    return platform;
+  }();
+  USE(platform);
+}
+
+// Builds a module exporting "main(count)", which applies {opcode} to a v128
+// local {count} times and returns lane 0 of the result.
+std::vector<byte> BuildModule(WasmOpcode opcode, OpShape shape) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  TestSignatures sigs;
+  WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+  WasmFunctionBuilder* f = builder->AddFunction(sigs.i_i());
+  builder->AddExport(CStrVector("main"), f);
+  constexpr byte kCount = 0;
+  const byte value = static_cast<byte>(f->AddLocal(kWasmS128));
+
+  std::vector<byte> op;
+  switch (shape) {
+    case OpShape::kUnop:
+      op = {WASM_SIMD_UNOP(opcode, WASM_LOCAL_GET(value))};
+      break;
+    case OpShape::kBinop:
+      op = {WASM_SIMD_BINOP(opcode, WASM_LOCAL_GET(value),
+                            WASM_LOCAL_GET(value))};
+      break;
+    case OpShape::kShiftByConstant:
+      op = {WASM_SIMD_SHIFT_OP(opcode, WASM_LOCAL_GET(value), WASM_I32V_1(3))};
+      break;
+    case OpShape::kShiftByRegister:
+      op = {WASM_SIMD_SHIFT_OP(opcode, WASM_LOCAL_GET(value),
+                               WASM_LOCAL_GET(kCount))};
+      break;
+  }
+
+  std::vector<byte> code = {
+      WASM_LOCAL_SET(value, WASM_SIMD_I32x4_SPLAT(WASM_LOCAL_GET(kCount))),
+      kExprLoop, kVoidCode};
+  code.insert(code.end(), op.begin(), op.end());
+  code.insert(code.end(),
+              {kExprLocalSet, value,
+               WASM_BR_IF(0, WASM_LOCAL_TEE(kCount,
+                                            WASM_I32_SUB(WASM_LOCAL_GET(kCount),
+                                                         WASM_ONE))),
+               kExprEnd,
+               WASM_SIMD_I32x4_EXTRACT_LANE(0, WASM_LOCAL_GET(value)),
+               kExprEnd});
+  f->EmitCode(code.data(), static_cast<uint32_t>(code.size()));
+
+  ZoneBuffer buffer(&zone);
+  builder->WriteTo(&buffer);
+  return std::vector<byte>(buffer.begin(), buffer.end());
+}
+
+void SimdOp(benchmark::State& state, WasmOpcode opcode, OpShape shape) {
+  InitializeV8Once();
+  v8::V8::SetFlagsFromString(state.range(0) == kLiftoff
+                                 ? "--liftoff --no-wasm-tier-up"
+                                 : "--no-liftoff");
+  std::vector<byte> wire_bytes = BuildModule(opcode, shape);
+
+  std::unique_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = array_buffer_allocator.get();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::ArrayBuffer> bytes =
+        v8::ArrayBuffer::New(isolate, wire_bytes.size());
+    std::memcpy(bytes->GetBackingStore()->Data(), wire_bytes.data(),
+                wire_bytes.size());
+    v8::Local<v8::Value> args[] = {bytes};
+    v8::Local<v8::String> source =
+        v8::String::NewFromUtf8Literal(isolate,
+                                       "(function(bytes) {"
+                                       "  let module = new WebAssembly.Module("
+                                       "      bytes);"
+                                       "  return new WebAssembly.Instance("
+                                       "      module).exports.main;"
+                                       "})");
+    v8::Local<v8::Function> instantiate = v8::Local<v8::Function>::Cast(
+        v8::Script::Compile(context, source)
+            .ToLocalChecked()
+            ->Run(context)
+            .ToLocalChecked());
+    v8::Local<v8::Function> main = v8::Local<v8::Function>::Cast(
+        instantiate->Call(context, context->Global(), 1, args)
+            .ToLocalChecked());
+
+    v8::Local<v8::Value> count = v8::Integer::New(isolate, kIterationsPerCall);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          main->Call(context, context->Global(), 1, &count));
+    }
+    state.SetItemsProcessed(state.iterations() * kIterationsPerCall);
+  }
+  isolate->Dispose();
+}
+
+#define SIMD_OP_BENCHMARK(name, shape)                                     \
+  BENCHMARK_CAPTURE(SimdOp, name##_##shape, kExpr##name, OpShape::k##shape) \
+      ->Arg(kLiftoff)                                                      \
+      ->Arg(kTurbofan)
+
+SIMD_OP_BENCHMARK(I32x4Add, Binop);
+SIMD_OP_BENCHMARK(I64x2Shl, ShiftByRegister);
+SIMD_OP_BENCHMARK(I64x2ShrS, ShiftByConstant);
+SIMD_OP_BENCHMARK(I64x2ShrS, ShiftByRegister);
+SIMD_OP_BENCHMARK(F32x4Min, Binop);
+SIMD_OP_BENCHMARK(F32x4Max, Binop);
+SIMD_OP_BENCHMARK(F64x2Min, Binop);
+SIMD_OP_BENCHMARK(F64x2Max, Binop);
+SIMD_OP_BENCHMARK(I8x16Swizzle, Binop);
+SIMD_OP_BENCHMARK(I8x16Popcnt, Unop);
+SIMD_OP_BENCHMARK(I32x4SConvertF32x4, Unop);
+SIMD_OP_BENCHMARK(I32x4UConvertF32x4, Unop);
+
+#undef SIMD_OP_BENCHMARK
+
+}  // namespace
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,107 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <set>
+#include <sstream>
+
+#include "src/diagnostics/compilation-statistics.h"
+#include "src/execution/isolate.h"
+#include "src/utils/ostreams.h"
+#include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// A small fixed corpus that exercises the main TurboFan phases (inlining,
+// typed lowering, loops, property access, calls). Keep it stable: the JSON
+// output of this test is used to track compile throughput over time. The test
+// only prints it when run with --turbo-stats-json.
+const char* kCorpus[] = {
+    "function add(a, b) { return a + b; }"
+    "function f0(x) { var s = 0; for (var i = 0; i < x; i++) s = add(s, i);"
+    "  return s; }",
+    "function f1(o) { return o.x * o.y + o.z; }",
+    "function f2(a) { var m = a[0]; for (var i = 1; i < a.length; i++) {"
+    "  if (a[i] > m) m = a[i]; } return m; }",
+    "function f3(s) { return s.length > 3 ? s.substring(1, 3) : s + '!'; }",
+};
+
+const char* kWarmup[] = {
+    "f0(10);",
+    "f1({x: 1, y: 2, z: 3});",
+    "f2([3, 1, 4, 1, 5]);",
+    "f3('hello'); f3('hi');",
+};
+
+const char* kFunctionNames[] = {"f0", "f1", "f2", "f3"};
+
+}  // namespace
+
+TEST(CompilationStatisticsJSON) {
+  const bool print_json = FLAG_turbo_stats_json;
+  FlagScope<bool> allow_natives_syntax(&FLAG_allow_natives_syntax, true);
+  FlagScope<bool> stats_json(&FLAG_turbo_stats_json, true);
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+
+  for (size_t i = 0; i < arraysize(kCorpus); i++) {
+    CompileRun(kCorpus[i]);
+    std::string name(kFunctionNames[i]);
+    CompileRun(("%PrepareFunctionForOptimization(" + name + ");").c_str());
+    CompileRun(kWarmup[i]);
+    CompileRun(kWarmup[i]);
+    CompileRun(("%OptimizeFunctionOnNextCall(" + name + ");").c_str());
+    CompileRun(kWarmup[i]);
+  }
+
+  Isolate* isolate = CcTest::i_isolate();
+  std::ostringstream os;
+  os << AsJSONStatistics{*isolate->GetTurboStatistics()};
+  if (print_json) StdoutStream{} << os.str() << std::endl;
+  // The flag is reset when the test returns, so the isolate must not find
+  // (and dump) the statistics when it is torn down.
+  delete isolate->turbo_statistics();
+  isolate->set_turbo_statistics(nullptr);
+
+  v8::Local<v8::Object> stats = v8::JSON::Parse(context, v8_str(os.str()))
+                                    .ToLocalChecked()
+                                    .As<v8::Object>();
+  v8::Local<v8::Object> totals = stats->Get(context, v8_str("totals"))
+                                     .ToLocalChecked()
+                                     .As<v8::Object>();
+  CHECK(totals->Get(context, v8_str("time_ms")).ToLocalChecked()->IsNumber());
+  CHECK_LT(0, totals->Get(context, v8_str("total_allocated_bytes"))
+                  .ToLocalChecked()
+                  ->NumberValue(context)
+                  .FromJust());
+
+  v8::Local<v8::Array> phase_kinds = stats->Get(context, v8_str("phase_kinds"))
+                                         .ToLocalChecked()
+                                         .As<v8::Array>();
+  std::set<std::string> names;
+  for (uint32_t i = 0; i < phase_kinds->Length(); i++) {
+    v8::Local<v8::Object> kind = phase_kinds->Get(context, i)
+                                     .ToLocalChecked()
+                                     .As<v8::Object>();
+    v8::String::Utf8Value name(
+        CcTest::isolate(),
+        kind->Get(context, v8_str("name")).ToLocalChecked());
+    names.insert(*name);
+    CHECK(kind->Get(context, v8_str("phases")).ToLocalChecked()->IsArray());
+  }
+  for (const char* expected :
+       {"V8.TFGraphCreation", "V8.TFLowering", "V8.TFBlockBuilding",
+        "V8.TFRegisterAllocation", "V8.TFCodeGeneration"}) {
+    CHECK_EQ(1, names.count(expected));
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -891,6 +891,22 @@ TEST(CloneCharacterStreams) {
     CHECK(!two_byte_string_stream->can_be_cloned());
   }
 
+  // On-heap strings copied off-heap for parallel access are clonable.
+  {
+    std::unique_ptr<i::Utf16CharacterStream> string_stream(
+        i::ScannerStream::ForParallelAccess(isolate, one_byte_string));
+    CHECK(string_stream->can_be_cloned_for_parallel_access());
+    TestCloneCharacterStream(one_byte_source, string_stream.get(), length);
+
+    i::Handle<i::String> two_byte_string =
+        factory->NewStringFromTwoByte(two_byte_vector).ToHandleChecked();
+    std::unique_ptr<i::Utf16CharacterStream> two_byte_string_stream(
+        i::ScannerStream::ForParallelAccess(isolate, two_byte_string));
+    CHECK(two_byte_string_stream->can_be_cloned_for_parallel_access());
+    TestCloneCharacterStream(one_byte_source, two_byte_string_stream.get(),
+                             length);
+  }
+
   // Chunk sources currently not cloneable.
   {
     const char* chunks[] = {"1234", "\0"};
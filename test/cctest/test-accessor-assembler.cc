@@ -11,6 +11,7 @@
 #include "src/objects/smi.h"
 #include "test/cctest/compiler/code-assembler-tester.h"
 #include "test/cctest/compiler/function-tester.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -115,11 +116,10 @@ Handle<Code> CreateCodeOfKind(CodeKind kind) {
   return data.GenerateCodeCloseAndEscape();
 }
 
-}  // namespace
-
-TEST(TryProbeStubCache) {
+void TestTryProbeStubCache(bool grow) {
   using Label = CodeStubAssembler::Label;
   Isolate* isolate(CcTest::InitIsolateOnce());
+  FlagScope<bool> adaptive_stub_cache(&FLAG_adaptive_stub_cache, true);
   const int kNumParams = 3;
   CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
   AccessorAssembler m(data.state());
@@ -210,6 +210,29 @@ TEST(TryProbeStubCache) {
   // own stub cache instance with raw values.
   DisallowGarbageCollection no_gc;
 
+  if (grow) {
+    // Thrash the stub cache, so that it grows when it gets cleared. The code
+    // generated above has to pick up the new tables.
+    const int kUpdates =
+        StubCache::kGrowthUpdatesPerEntry * StubCache::kPrimaryTableSize + 1;
+    for (int i = 0; i < kUpdates; i++) {
+      int index = rand_gen.NextInt();
+      Handle<Name> name = names[index % names.size()];
+      Handle<JSObject> receiver = receivers[index % receivers.size()];
+      Handle<Code> handler = handlers[index % handlers.size()];
+      stub_cache.Set(*name, receiver->map(), MaybeObject::FromObject(*handler));
+    }
+    stub_cache.Clear();
+    CHECK_EQ(2 * StubCache::kPrimaryTableSize,
+             stub_cache.table_size(StubCache::kPrimary));
+    CHECK_EQ(2 * StubCache::kSecondaryTableSize,
+             stub_cache.table_size(StubCache::kSecondary));
+  } else {
+    stub_cache.Clear();
+    CHECK_EQ(StubCache::kPrimaryTableSize,
+             stub_cache.table_size(StubCache::kPrimary));
+  }
+
   // Populate {stub_cache}.
   const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
   for (int i = 0; i < N; i++) {
@@ -257,5 +280,11 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+}  // namespace
+
+TEST(TryProbeStubCache) { TestTryProbeStubCache(false); }
+
+TEST(TryProbeGrownStubCache) { TestTryProbeStubCache(true); }
+
 }  // namespace internal
 }  // namespace v8
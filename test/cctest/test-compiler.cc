@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <wchar.h>
 #include <memory>
+#include <string>
 
 #include "src/init/v8.h"
 
@@ -36,6 +37,7 @@
 #include "src/api/api-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/diagnostics/disasm.h"
 #include "src/heap/factory.h"
 #include "src/heap/spaces.h"
@@ -861,6 +863,36 @@ TEST(DeepEagerCompilation) {
   }
 }
 
+TEST(ParallelCompileOption) {
+  if (i::FLAG_single_threaded) return;
+  i::FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  // On-heap sources are only handed to worker threads if they are long enough
+  // to be worth copying off-heap.
+  std::string source = "var f = (function f(x) { return x + 1; });\n//";
+  source.append(32 * i::KB, ' ');
+  v8::ScriptCompiler::Source script_source(v8_str(source.c_str()));
+  v8::Local<v8::Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &script_source,
+                                  v8::ScriptCompiler::kParallelCompile)
+          .ToLocalChecked();
+  script->Run(env.local()).ToLocalChecked();
+
+  // The eager top-level function was handed to the compiler dispatcher, and
+  // its first call finishes the job.
+  i::Handle<i::JSFunction> f = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*env->Global()->Get(env.local(), v8_str("f"))
+                                 .ToLocalChecked()));
+  i::Handle<i::SharedFunctionInfo> shared(f->shared(), isolate);
+  CHECK(isolate->compiler_dispatcher()->IsEnqueued(shared));
+  CHECK_EQ(2, CompileRun("f(1)")->Int32Value(env.local()).FromJust());
+  CHECK(!isolate->compiler_dispatcher()->IsEnqueued(shared));
+  CHECK(shared->is_compiled());
+}
+
 TEST(DeepEagerCompilationPeakMemory) {
   i::FLAG_always_opt = false;
   CcTest::InitializeVM();
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "include/libplatform/libplatform.h"
 #include "src/api/api.h"
 #include "src/base/platform/semaphore.h"
 #include "src/handles/handles-inl.h"
@@ -11,6 +12,7 @@
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
+#include "src/objects/string-table.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 
@@ -236,6 +238,83 @@ TEST(InspectTwoByteExternalizing) {
   thread->Join();
 }
 
+class ConcurrentInternalizationThread final : public v8::base::Thread {
+ public:
+  ConcurrentInternalizationThread(Isolate* isolate, int count,
+                                  std::atomic<int>* pending)
+      : v8::base::Thread(base::Thread::Options("ThreadWithLocalHeap")),
+        isolate_(isolate),
+        count_(count),
+        pending_(pending) {}
+
+  void Run() override {
+    LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
+    UnparkedScope unparked_scope(local_isolate.heap());
+    for (int i = 0; i < count_; i++) {
+      LocalHandleScope scope(&local_isolate);
+      EmbeddedVector<char, 32> buffer;
+      int length = SNPrintF(buffer, "internalized-%d", i);
+      Handle<String> string = local_isolate.factory()->InternalizeString(
+          Vector<const uint8_t>(
+              reinterpret_cast<const uint8_t*>(buffer.begin()), length));
+      CHECK(string->IsInternalizedString());
+      strings_.push_back(local_isolate.heap()->NewPersistentHandle(string));
+    }
+    ph_ = local_isolate.heap()->DetachPersistentHandles();
+    pending_->fetch_sub(1);
+  }
+
+  Handle<String> string(int i) const { return strings_[i]; }
+
+ private:
+  Isolate* isolate_;
+  int count_;
+  std::atomic<int>* pending_;
+  std::vector<Handle<String>> strings_;
+  std::unique_ptr<PersistentHandles> ph_;
+};
+
+// Internalize the same strings on several background threads at once, growing
+// the string table on the way. Every thread has to end up with the same
+// internalized string for each key.
+TEST(ConcurrentInternalization) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope handle_scope(isolate);
+
+  const int kThreads = 4;
+  // Enough strings to force the string table to grow at least once.
+  const int kStrings = isolate->string_table()->Capacity();
+
+  std::atomic<int> pending(kThreads);
+  std::vector<std::unique_ptr<ConcurrentInternalizationThread>> threads;
+  for (int i = 0; i < kThreads; i++) {
+    auto thread = std::make_unique<ConcurrentInternalizationThread>(
+        isolate, kStrings, &pending);
+    CHECK(thread->Start());
+    threads.push_back(std::move(thread));
+  }
+
+  while (pending > 0) {
+    v8::platform::PumpMessageLoop(i::V8::GetCurrentPlatform(),
+                                  CcTest::isolate());
+  }
+
+  for (auto& thread : threads) {
+    thread->Join();
+  }
+
+  for (int i = 0; i < kStrings; i++) {
+    EmbeddedVector<char, 32> buffer;
+    SNPrintF(buffer, "internalized-%d", i);
+    Handle<String> string =
+        isolate->factory()->InternalizeUtf8String(buffer.begin());
+    for (auto& thread : threads) {
+      CHECK_EQ(*string, *thread->string(i));
+    }
+  }
+}
+
 }  // anonymous namespace
 
 }  // namespace internal
@@ -34,6 +34,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/factory.h"
 #include "src/heap/spaces.h"
+#include "src/objects/dictionary-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/roots/roots.h"
@@ -306,6 +307,47 @@ TEST(ObjectHashTableCausesGC) {
 }
 #endif
 
+TEST(NameDictionaryWipesDeletedEntriesInPlace) {
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(context->GetIsolate());
+
+  auto name = [=](int i) {
+    EmbeddedVector<char, 16> buffer;
+    SNPrintF(buffer, "k%d", i);
+    return factory->InternalizeUtf8String(buffer.begin());
+  };
+
+  const int kLiveKeys = 40;
+  Handle<NameDictionary> dictionary = NameDictionary::New(isolate, 64);
+  for (int i = 0; i < kLiveKeys; i++) {
+    dictionary = NameDictionary::Add(isolate, dictionary, name(i), name(i),
+                                     PropertyDetails::Empty());
+  }
+  Handle<NameDictionary> original = dictionary;
+  const int capacity = dictionary->Capacity();
+
+  // Keep the number of elements constant while deleting and adding keys.
+  // Deleted entries must be wiped in place rather than by reallocating.
+  for (int i = kLiveKeys; i < 20 * capacity; i++) {
+    InternalIndex entry = dictionary->FindEntry(isolate, name(i - kLiveKeys));
+    CHECK(entry.is_found());
+    dictionary = NameDictionary::DeleteEntry(isolate, dictionary, entry);
+    dictionary = NameDictionary::Add(isolate, dictionary, name(i), name(i),
+                                     PropertyDetails::Empty());
+    CHECK_EQ(*original, *dictionary);
+    CHECK_EQ(capacity, dictionary->Capacity());
+    CHECK_EQ(kLiveKeys, dictionary->NumberOfElements());
+  }
+  for (int i = 20 * capacity - kLiveKeys; i < 20 * capacity; i++) {
+    InternalIndex entry = dictionary->FindEntry(isolate, name(i));
+    CHECK(entry.is_found());
+    CHECK_EQ(*name(i), dictionary->ValueAt(entry));
+  }
+  CHECK(dictionary->FindEntry(isolate, name(0)).is_not_found());
+}
+
 TEST(MaximumClonedShallowObjectProperties) {
   // Assert that a NameDictionary with kMaximumClonedShallowObjectProperties is
   // not in large-object space.
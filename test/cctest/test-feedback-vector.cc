@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <map>
+#include <string>
+
 #include "src/init/v8.h"
 #include "test/cctest/cctest.h"
 
@@ -804,6 +807,42 @@ TEST(StoreOwnIC) {
   CHECK_EQ(MONOMORPHIC, nexus.ic_state());
 }
 
+std::map<std::string, int>* feedback_counters = nullptr;
+
+TEST(FeedbackAllocationCounters) {
+  FLAG_lazy_feedback_allocation = false;
+  std::map<std::string, int> counters;
+  feedback_counters = &counters;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.counter_lookup_callback = [](const char* name) {
+    return &(*feedback_counters)[name];
+  };
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    int vectors = counters["c:V8.FeedbackVectorsCreated"];
+    int vector_bytes = counters["c:V8.FeedbackVectorBytesCreated"];
+    int cell_array_bytes =
+        counters["c:V8.ClosureFeedbackCellArrayBytesCreated"];
+    CompileRunChecked(isolate,
+                      "function f(o) { return o.x; }"
+                      "f({x: 1});");
+    // At least the script and {f} got a feedback vector, and the script's
+    // closure feedback cell array holds the cell for {f}.
+    CHECK_LE(vectors + 2, counters["c:V8.FeedbackVectorsCreated"]);
+    CHECK_LT(vector_bytes, counters["c:V8.FeedbackVectorBytesCreated"]);
+    CHECK_LT(cell_array_bytes,
+             counters["c:V8.ClosureFeedbackCellArrayBytesCreated"]);
+  }
+  isolate->Dispose();
+  feedback_counters = nullptr;
+}
+
 }  // namespace
 
 }  // namespace internal
@@ -789,6 +789,61 @@ TEST(OrderedHashMapDeletion) {
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key3));
 }
 
+TEST(OrderedHashMapShrinkMinimumCapacity) {
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Handle<Smi> key1(Smi::FromInt(1), isolate);
+  Handle<Smi> value1(Smi::FromInt(1), isolate);
+
+  Handle<OrderedHashMap> map = factory->NewOrderedHashMap();
+  CHECK_EQ(OrderedHashMap::kInitialCapacity, map->Capacity());
+  map = OrderedHashMap::Add(isolate, map, key1, value1).ToHandleChecked();
+  Handle<OrderedHashMap> original = map;
+
+  // Emptying a minimum-size table must not reallocate it.
+  CHECK(OrderedHashMap::Delete(isolate, *map, *key1));
+  map = OrderedHashMap::Shrink(isolate, map);
+  Verify(isolate, map);
+  CHECK_EQ(*original, *map);
+  CHECK(!map->IsObsolete());
+  CHECK_EQ(0, map->NumberOfElements());
+  CHECK_EQ(1, map->NumberOfDeletedElements());
+
+  // The deleted entries are only cleared out once they fill the table.
+  for (int i = 1; i < OrderedHashMap::kInitialCapacity; i++) {
+    map = OrderedHashMap::Add(isolate, map, key1, value1).ToHandleChecked();
+    CHECK(OrderedHashMap::Delete(isolate, *map, *key1));
+    map = OrderedHashMap::Shrink(isolate, map);
+    Verify(isolate, map);
+    CHECK_EQ(*original, *map);
+  }
+  CHECK_EQ(OrderedHashMap::kInitialCapacity, map->NumberOfDeletedElements());
+  map = OrderedHashMap::Add(isolate, map, key1, value1).ToHandleChecked();
+  Verify(isolate, map);
+  CHECK_NE(*original, *map);
+  CHECK(original->IsObsolete());
+  CHECK_EQ(OrderedHashMap::kInitialCapacity, map->Capacity());
+  CHECK_EQ(1, map->NumberOfElements());
+  CHECK_EQ(0, map->NumberOfDeletedElements());
+
+  // Larger tables still shrink once they are mostly empty.
+  for (int i = 0; i < 16; i++) {
+    Handle<Smi> key(Smi::FromInt(i), isolate);
+    map = OrderedHashMap::Add(isolate, map, key, value1).ToHandleChecked();
+  }
+  CHECK_EQ(16, map->Capacity());
+  for (int i = 0; i < 14; i++) {
+    CHECK(OrderedHashMap::Delete(isolate, *map, Smi::FromInt(i)));
+  }
+  map = OrderedHashMap::Shrink(isolate, map);
+  Verify(isolate, map);
+  CHECK_EQ(8, map->Capacity());
+  CHECK_EQ(2, map->NumberOfElements());
+  CHECK_EQ(0, map->NumberOfDeletedElements());
+}
+
 TEST(SmallOrderedHashMapDeletion) {
   LocalContext context;
   Isolate* isolate = GetIsolateFrom(&context);
@@ -2115,8 +2170,10 @@ TEST(OrderedNameDictionaryDeleteEntry) {
     CHECK(entry.is_not_found());
   }
   CHECK_EQ(0, dict->NumberOfElements());
-  // Dictionary shrunk again.
-  CHECK_EQ(0, dict->NumberOfDeletedElements());
+  // Dictionary shrunk again, down to the minimum capacity, which keeps its
+  // deleted entries instead of being copied.
+  CHECK_EQ(OrderedNameDictionary::kInitialCapacity, dict->Capacity());
+  CHECK_EQ(1, dict->NumberOfDeletedElements());
 }
 
 TEST(SmallOrderedNameDictionaryDeleteEntry) {
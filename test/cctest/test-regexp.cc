@@ -37,6 +37,7 @@
 #include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -2367,6 +2368,34 @@ TEST(UnicodePropertyEscapeCodeSize) {
   }
 }
 
+TEST(SharedBytecodeCacheAcrossIsolates) {
+  i::FlagScope<bool> interpret_all(&i::FLAG_regexp_interpret_all, true);
+  const char* source =
+      "var m = /(\\d+)-(?<word>[a-z]+)/.exec('xx 12-ab 34-cd');"
+      "m[1] + m.groups.word";
+
+  size_t hits_before = 0;
+  for (int i = 0; i < 2; i++) {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      hits_before = RegExpBytecodeCache::HitsForTesting();
+      v8::Local<v8::Value> result =
+          CompileRun(context, source).ToLocalChecked();
+      v8::String::Utf8Value utf8(isolate, result);
+      CHECK_EQ(0, strcmp("12ab", *utf8));
+    }
+    isolate->Dispose();
+  }
+  // The second isolate reused the bytecode compiled by the first one.
+  CHECK_LT(hits_before, RegExpBytecodeCache::HitsForTesting());
+}
+
 #undef CHECK_PARSE_ERROR
 #undef CHECK_SIMPLE
 #undef CHECK_MIN_MAX
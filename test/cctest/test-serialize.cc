@@ -28,6 +28,8 @@
 #include <signal.h>
 #include <sys/stat.h>
 
+#include <string>
+
 #include "src/api/api-inl.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
@@ -2490,6 +2492,163 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerHotnessHint) {
+  // The test relies on deterministic tier-up with TurboFan.
+  if (!FLAG_opt || FLAG_always_opt || FLAG_turboprop) return;
+  FLAG_cache_hotness_hints = true;
+  FLAG_lazy_feedback_allocation = false;
+  FLAG_concurrent_recompilation = false;
+  FLAG_flush_bytecode = false;
+  // Every call then ends with a profiler tick.
+  FLAG_interrupt_budget = 16;
+
+  // The functions are too large to be optimized as small functions, so only
+  // the hot-and-stable heuristic marks them.
+  std::string body;
+  for (int i = 0; i < 10; i++) body += "a = a * 3 + 1; a = a % 1000;";
+  std::string source_str = "function f(a) {" + body + "return a; }" +
+                           "function g(a) {" + body + "return a; }";
+  const char* source = source_str.c_str();
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate1, v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source_obj)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    // The runtime profiler sets the hint when it marks {f} as hot.
+    CompileRun("for (var i = 0; i < 10; i++) f(i);");
+    Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    CHECK(f->shared().was_marked_hot());
+    cache = ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(
+        v8_str(source), origin,
+        new v8::ScriptCompiler::CachedData(cache->data, cache->length));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_obj, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!source_obj.GetCachedData()->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    Handle<JSFunction> g = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("g")).ToLocalChecked()));
+    CHECK(f->shared().was_marked_hot());
+    CHECK(!g->shared().was_marked_hot());
+
+    // With the hint, the first tick marks {f} for optimization. {g} needs the
+    // regular number of ticks.
+    CompileRun("f(1); g(1);");
+    CHECK(f->IsMarkedForOptimization());
+    CHECK(!g->IsMarkedForOptimization());
+    CompileRun("f(2);");
+    CHECK(f->HasAttachedOptimizedCode());
+
+    // An eager deopt drops the hint.
+    CompileRun("f('a');");
+    CHECK(!f->shared().was_marked_hot());
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
+TEST(CodeSerializerNCICode) {
+  // The test relies on deterministic optimization.
+  if (!FLAG_opt || FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_flush_bytecode = false;
+  FLAG_serialize_nci_code = true;
+  FlagList::EnforceFlagImplications();
+
+  // NCI code is written to the code cache and installed into the
+  // compilation cache of the consuming isolate.
+  const char* source =
+      "function f(a, b) { return a + b; }; f('ab', 'c') + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate1, v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source_obj)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CompileRun(
+        "%PrepareFunctionForOptimization(f);"
+        "f('ab', 'c');"
+        "%OptimizeFunctionOnNextCall(f);"
+        "f('ab', 'c');");
+    Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+    CHECK(!f->shared().TryGetCachedCode(i_isolate1).is_null());
+    cache = ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    // {source_obj} takes ownership of the cached data it is given, so hand it
+    // a view of {cache} and keep {cache} owned by the test.
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(
+        v8_str(source), origin,
+        new v8::ScriptCompiler::CachedData(cache->data, cache->length));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_obj, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!source_obj.GetCachedData()->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+    // The first call of {f} picked up the deserialized code.
+    Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    CHECK_EQ(f->code().kind(), CodeKind::NATIVE_CONTEXT_INDEPENDENT);
+    CHECK(CompileRun("f(1, 2)")->Equals(context, v8_num(3)).FromJust());
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
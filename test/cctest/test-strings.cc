@@ -1348,6 +1348,40 @@ TEST(SliceFromCons) {
   CHECK(slice->IsFlat());
 }
 
+TEST(StringAddMergesShortAppendedPiece) {
+  // TurboFan may allocate the ConsString inline, bypassing StringAdd.
+  if (FLAG_always_opt) return;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  CompileRun(
+      "var head = 'abcdefghijklmnop';"
+      "var tail = 'qrstuvwxyz';"
+      "var s = head + tail;");
+  Handle<String> head =
+      v8::Utils::OpenHandle(v8::String::Cast(*CompileRun("head")));
+  Handle<String> before =
+      v8::Utils::OpenHandle(v8::String::Cast(*CompileRun("s")));
+  CHECK(before->IsConsString());
+
+  // The appended piece is merged into the sequential second part.
+  Handle<String> merged =
+      v8::Utils::OpenHandle(v8::String::Cast(*CompileRun("s += 'x'; s")));
+  CHECK(merged->IsConsString());
+  ConsString cons = ConsString::cast(*merged);
+  CHECK_EQ(*head, cons.first());
+  CHECK(cons.second().IsSeqOneByteString());
+  CHECK_EQ(0, strcmp("qrstuvwxyzx", cons.second().ToCString().get()));
+  // The original string is left alone.
+  CHECK_EQ(0, strcmp("qrstuvwxyz",
+                     ConsString::cast(*before).second().ToCString().get()));
+
+  // A piece of a different encoding is not merged.
+  Handle<String> two_byte = v8::Utils::OpenHandle(
+      v8::String::Cast(*CompileRun("s + String.fromCharCode(0x3b4)")));
+  CHECK(two_byte->IsConsString());
+  CHECK_EQ(*merged, ConsString::cast(*two_byte).first());
+}
+
 class OneByteVectorResource : public v8::String::ExternalOneByteStringResource {
  public:
   explicit OneByteVectorResource(i::Vector<const char> vector)
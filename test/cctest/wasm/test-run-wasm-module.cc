@@ -2,10 +2,13 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "src/api/api-inl.h"
+#include "src/base/functional.h"
+#include "src/base/platform/platform.h"
 #include "src/objects/objects-inl.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/utils/version.h"
@@ -320,6 +323,92 @@ TEST(Run_WasmModule_CompilationHintsLazyBaselineEagerTopTier) {
   Cleanup();
 }
 
+TEST(Run_WasmModule_ProfileGuidedPrefetch) {
+  if (!FLAG_wasm_tier_up || !FLAG_liftoff) return;
+  FLAG_SCOPE(wasm_lazy_compilation);
+  FLAG_SCOPE(wasm_pgo_to_file);
+
+  static const int32_t kReturnValue = 114;
+  static const int kMainIndex = 0;
+  static const int kUnusedIndex = 1;
+  TestSignatures sigs;
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+
+  WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+  WasmFunctionBuilder* f = builder->AddFunction(sigs.i_v());
+  ExportAsMain(f);
+  byte code[] = {WASM_I32V_2(kReturnValue)};
+  EMIT_CODE_WITH_END(f, code);
+  WasmFunctionBuilder* g = builder->AddFunction(sigs.i_v());
+  g->builder()->AddExport(CStrVector("unused"), g);
+  EMIT_CODE_WITH_END(g, code);
+  ZoneBuffer buffer(&zone);
+  builder->WriteTo(&buffer);
+  ModuleWireBytes wire_bytes(buffer.begin(), buffer.end());
+
+  // Must match the file name used by {DumpProfileToFile}.
+  EmbeddedVector<char, 32> profile_name;
+  SNPrintF(profile_name, "profile-wasm-%016zx",
+           base::hash_range(buffer.begin(), buffer.end()));
+  auto profile_exists = [&profile_name] {
+    FILE* file = base::OS::FOpen(profile_name.begin(), "rb");
+    if (file == nullptr) return false;
+    fclose(file);
+    return true;
+  };
+  remove(profile_name.begin());
+
+  // Profiled run: only "main" is called, so only "main" is recorded. The
+  // profile is written when the module dies.
+  {
+    Isolate* isolate = CcTest::InitIsolateOnce();
+    HandleScope scope(isolate);
+    testing::SetupIsolateForWasmModule(isolate);
+    ErrorThrower thrower(isolate, "CompileAndRunWasmModule");
+    MaybeHandle<WasmModuleObject> module =
+        testing::CompileForTesting(isolate, &thrower, wire_bytes);
+    CHECK(!module.is_null());
+    MaybeHandle<WasmInstanceObject> instance =
+        isolate->wasm_engine()->SyncInstantiate(
+            isolate, &thrower, module.ToHandleChecked(), {}, {});
+    CHECK(!instance.is_null());
+    CHECK_EQ(kReturnValue,
+             testing::CallWasmFunctionForTesting(
+                 isolate, instance.ToHandleChecked(), "main", 0, nullptr));
+  }
+  Cleanup();
+  CHECK(profile_exists());
+
+  // Guided runs: "main" is compiled in the background and then tiered up
+  // without ever being called, while "unused" stays lazy. The second guided
+  // run only succeeds if the first one recorded the prefetched function again.
+  FLAG_SCOPE(wasm_pgo_from_file);
+  for (int run = 0; run < 2; ++run) {
+    {
+      Isolate* isolate = CcTest::InitIsolateOnce();
+      HandleScope scope(isolate);
+      testing::SetupIsolateForWasmModule(isolate);
+      ErrorThrower thrower(isolate, "CompileAndRunWasmModule");
+      MaybeHandle<WasmModuleObject> module =
+          testing::CompileForTesting(isolate, &thrower, wire_bytes);
+      CHECK(!module.is_null());
+      NativeModule* native_module = module.ToHandleChecked()->native_module();
+
+      // Busy wait for the prefetched baseline code, then for its tier-up.
+      while (!native_module->HasCode(kMainIndex)) {
+      }
+      while (!native_module->HasCodeWithTier(kMainIndex,
+                                             ExecutionTier::kTurbofan)) {
+      }
+      CHECK(!native_module->HasCode(kUnusedIndex));
+    }
+    Cleanup();
+    CHECK(profile_exists());
+  }
+  remove(profile_name.begin());
+}
+
 TEST(Run_WasmModule_CallAdd) {
   {
     v8::internal::AccountingAllocator allocator;
@@ -953,8 +953,8 @@ WASM_SIMD_TEST(I64x2Neg) {
 
 void RunI64x2ShiftOpTest(TestExecutionTier execution_tier, LowerSimd lower_simd,
                          WasmOpcode opcode, Int64ShiftOp expected_op) {
-  // Intentionally shift by 64, should be no-op.
-  for (int shift = 1; shift <= 64; shift++) {
+  // Intentionally shift by 0 and 64, should be no-ops.
+  for (int shift = 0; shift <= 64; shift++) {
     WasmRunner<int32_t, int64_t> r(execution_tier, lower_simd);
     int32_t* memory = r.builder().AddMemoryElems<int32_t>(1);
     int64_t* g_imm = r.builder().AddGlobal<int64_t>(kWasmS128);
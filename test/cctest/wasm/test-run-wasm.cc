@@ -10,7 +10,9 @@
 #include "src/base/overflowing-math.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/codegen/assembler-inl.h"
+#include "src/compiler/all-nodes.h"
 #include "src/utils/utils.h"
+#include "src/wasm/graph-builder-interface.h"
 #include "src/wasm/wasm-opcodes-inl.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/compiler/value-helper.h"
@@ -2061,6 +2063,113 @@ TEST(Build_Wasm_SimpleExprs) {
 #undef GRAPH_BUILD_TEST
 }
 
+// Builds the TurboFan graph for {code} without the trap handler and counts the
+// explicit memory bounds checks in it. The memory has one initial page and
+// {maximum_pages} maximum pages. If {constant_size_checks} is given, it receives
+// the number of checks that compare against a constant memory size.
+static int CountMemoryBoundsChecks(const FunctionSig* sig, const byte* start,
+                                   const byte* end, uint32_t maximum_pages = 2,
+                                   int* constant_size_checks = nullptr) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  Zone zone(isolate->allocator(), ZONE_NAME, kCompressGraphZone);
+  HandleScope scope(isolate);
+  compiler::CommonOperatorBuilder common(&zone);
+  compiler::MachineOperatorBuilder machine(
+      &zone, MachineType::PointerRepresentation(),
+      compiler::MachineOperatorBuilder::kAllOptionalOps);
+  compiler::Graph graph(&zone);
+  compiler::JSGraph jsgraph(isolate, &graph, &common, nullptr, nullptr,
+                            &machine);
+  WasmModule module;
+  module.has_memory = true;
+  module.initial_pages = 1;
+  module.maximum_pages = maximum_pages;
+  module.has_maximum_pages = true;
+  CompilationEnv env(&module, kNoTrapHandler, kRuntimeExceptionSupport,
+                     WasmFeatures::All());
+  compiler::WasmGraphBuilder builder(&env, &zone, &jsgraph, sig, nullptr);
+  WasmFeatures unused_detected_features;
+  FunctionBody body(sig, 0, start, end);
+  CHECK(BuildTFGraph(isolate->allocator(), WasmFeatures::All(), &module,
+                     &builder, &unused_detected_features, body, nullptr)
+            .ok());
+
+  int count = 0;
+  if (constant_size_checks) *constant_size_checks = 0;
+  compiler::AllNodes all_nodes(&zone, &graph);
+  for (compiler::Node* node : all_nodes.reachable) {
+    if (node->opcode() != compiler::IrOpcode::kTrapUnless ||
+        compiler::TrapIdOf(node->op()) !=
+            compiler::TrapId::kTrapMemOutOfBounds) {
+      continue;
+    }
+    count++;
+    if (constant_size_checks == nullptr) continue;
+    // The check is {index < mem_size - end_offset}.
+    compiler::Node* effective_size = node->InputAt(0)->InputAt(1);
+    compiler::Node* mem_size = effective_size->InputAt(0);
+    if (mem_size->opcode() == compiler::IrOpcode::kInt32Constant ||
+        mem_size->opcode() == compiler::IrOpcode::kInt64Constant) {
+      (*constant_size_checks)++;
+    }
+  }
+  return count;
+}
+
+TEST(Build_Wasm_RedundantBoundsChecks) {
+  if (!FLAG_wasm_bounds_checks) return;
+  TestSignatures sigs;
+  {
+    // The second access is covered by the check of the first one.
+    byte code[] = {
+        WASM_NO_LOCALS,
+        WASM_I32_ADD(
+            WASM_LOAD_MEM_OFFSET(MachineType::Int32(), 8, WASM_LOCAL_GET(0)),
+            WASM_LOAD_MEM(MachineType::Uint8(), WASM_LOCAL_GET(0))),
+        WASM_END};
+    CHECK_EQ(1, CountMemoryBoundsChecks(sigs.i_i(), code,
+                                        code + arraysize(code)));
+  }
+  {
+    // The second access reaches further than the first one.
+    byte code[] = {
+        WASM_NO_LOCALS,
+        WASM_I32_ADD(
+            WASM_LOAD_MEM(MachineType::Uint8(), WASM_LOCAL_GET(0)),
+            WASM_LOAD_MEM_OFFSET(MachineType::Int32(), 8, WASM_LOCAL_GET(0))),
+        WASM_END};
+    CHECK_EQ(2, CountMemoryBoundsChecks(sigs.i_i(), code,
+                                        code + arraysize(code)));
+  }
+  {
+    // A memory.grow in between reloads the memory size.
+    byte code[] = {WASM_NO_LOCALS,
+                   WASM_LOAD_MEM(MachineType::Int32(), WASM_LOCAL_GET(0)),
+                   kExprDrop,
+                   WASM_GROW_MEMORY(WASM_LOCAL_GET(1)),
+                   kExprDrop,
+                   WASM_LOAD_MEM(MachineType::Int32(), WASM_LOCAL_GET(0)),
+                   WASM_END};
+    CHECK_EQ(2, CountMemoryBoundsChecks(sigs.i_ii(), code,
+                                        code + arraysize(code)));
+  }
+  {
+    // The memory size is only a constant if the memory cannot grow.
+    byte code[] = {WASM_NO_LOCALS,
+                   WASM_LOAD_MEM(MachineType::Int32(), WASM_LOCAL_GET(0)),
+                   WASM_END};
+    int constant_size_checks;
+    CHECK_EQ(1, CountMemoryBoundsChecks(sigs.i_i(), code,
+                                        code + arraysize(code), 2,
+                                        &constant_size_checks));
+    CHECK_EQ(0, constant_size_checks);
+    CHECK_EQ(1, CountMemoryBoundsChecks(sigs.i_i(), code,
+                                        code + arraysize(code), 1,
+                                        &constant_size_checks));
+    CHECK_EQ(1, constant_size_checks);
+  }
+}
+
 WASM_EXEC_TEST(Int32LoadInt8_signext) {
   WasmRunner<int32_t, int32_t> r(execution_tier);
   const int kNumElems = kWasmPageSize;
@@ -145,6 +145,34 @@ TEST(CacheHitMissSig) {
   CHECK_EQ(c2, c4);
 }
 
+TEST(CacheHitEqualSig) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  auto module = NewModule(isolate);
+  TestSignatures sigs;
+  WasmCodeRefScope wasm_code_ref_scope;
+  WasmImportWrapperCache::ModificationScope cache_scope(
+      module->import_wrapper_cache());
+
+  auto kind = compiler::WasmImportCallKind::kJSFunctionArityMatch;
+  auto sig1 = sigs.i_i();
+  // A distinct signature object with the same return and parameter types.
+  ValueType reps[] = {kWasmI32, kWasmI32};
+  FunctionSig sig2(1, 1, reps);
+  CHECK_NE(sig1, &sig2);
+  int expected_arity = static_cast<int>(sig1->parameter_count());
+
+  WasmCode* c1 = CompileImportWrapper(isolate->wasm_engine(), module.get(),
+                                      isolate->counters(), kind, sig1,
+                                      expected_arity, &cache_scope);
+
+  CHECK_NOT_NULL(c1);
+
+  WasmCode* c2 = cache_scope[{kind, &sig2, expected_arity}];
+
+  CHECK_NOT_NULL(c2);
+  CHECK_EQ(c1, c2);
+}
+
 }  // namespace test_wasm_import_wrapper_cache
 }  // namespace wasm
 }  // namespace internal
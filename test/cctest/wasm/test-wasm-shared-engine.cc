@@ -13,6 +13,7 @@
 #include "src/wasm/wasm-objects-inl.h"
 
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 #include "test/common/wasm/test-signatures.h"
 #include "test/common/wasm/wasm-macro-gen.h"
 #include "test/common/wasm/wasm-module-runner.h"
@@ -360,6 +361,64 @@ TEST(SharedEngineRunThreadedTierUp) {
   for (auto& thread : threads) thread.Join();
 }
 
+TEST(SharedEngineCodeGCFreesFinishedModules) {
+  FLAG_SCOPE(liftoff);
+  FLAG_SCOPE(wasm_code_gc);
+  FlagScope<bool> no_tier_up(&FLAG_wasm_tier_up, false);
+  FlagScope<bool> no_lazy_compilation(&FLAG_wasm_lazy_compilation, false);
+  SharedEngine engine;
+  // Module 1 is used by isolates 1a and 1b, module 2 only by isolate 2.
+  SharedEngineIsolate isolate1a(&engine);
+  SharedEngineIsolate isolate1b(&engine);
+  SharedEngineIsolate isolate2(&engine);
+  HandleScope scope1a(isolate1a.isolate());
+  HandleScope scope1b(isolate1b.isolate());
+  HandleScope scope2(isolate2.isolate());
+  Handle<WasmInstanceObject> instance1 = isolate1a.CompileAndInstantiate(
+      BuildReturnConstantModule(isolate1a.zone(), 23));
+  SharedModule module1 = isolate1a.ExportInstance(instance1);
+  isolate1b.ImportInstance(module1);
+  Handle<WasmInstanceObject> instance2 = isolate2.CompileAndInstantiate(
+      BuildReturnConstantModule(isolate2.zone(), 42));
+  SharedModule module2 = isolate2.ExportInstance(instance2);
+  {
+    WasmCodeRefScope code_ref_scope;
+    if (module1->GetCode(0)->tier() != ExecutionTier::kLiftoff ||
+        module2->GetCode(0)->tier() != ExecutionTier::kLiftoff) {
+      return;  // Liftoff bailed out, nothing gets replaced below.
+    }
+  }
+
+  // Replace the Liftoff code of both modules. The first replacement stays
+  // below the GC limit, the second one triggers a GC covering both.
+  WasmFeatures detected = WasmFeatures::None();
+  WasmCompilationUnit::CompileWasmFunction(
+      isolate2.isolate(), module2.get(), &detected,
+      &module2->module()->functions[0], ExecutionTier::kTurbofan);
+  {
+    FLAG_SCOPE(stress_wasm_code_gc);
+    WasmCompilationUnit::CompileWasmFunction(
+        isolate1a.isolate(), module1.get(), &detected,
+        &module1->module()->functions[0], ExecutionTier::kTurbofan);
+  }
+  CHECK_EQ(0, module1->freed_code_size());
+  CHECK_EQ(0, module2->freed_code_size());
+
+  // Module 1 still runs in isolate 1b, so its dead code must be kept.
+  engine.engine()->ReportLiveCodeFromStackForGC(isolate1a.isolate());
+  CHECK_EQ(0, module1->freed_code_size());
+  CHECK_EQ(0, module2->freed_code_size());
+
+  // All isolates of module 1 have reported now. Its dead code is freed while
+  // the GC still waits for isolate 2.
+  engine.engine()->ReportLiveCodeFromStackForGC(isolate1b.isolate());
+  CHECK_LT(0, module1->freed_code_size());
+  CHECK_EQ(0, module2->freed_code_size());
+
+  engine.engine()->ReportLiveCodeFromStackForGC(isolate2.isolate());
+  CHECK_LT(0, module2->freed_code_size());
+}
+
 }  // namespace test_wasm_shared_engine
 }  // namespace wasm
 }  // namespace internal
@@ -0,0 +1,42 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --max-polymorphic-inlining-targets=8
+
+// A call site whose target is a Phi of six known closures can be inlined
+// polymorphically once the target limit is raised above the default. Each
+// target reports whether it runs in the interpreter, which is only false once
+// it has been inlined into optimized {foo}.
+function f0(x) { return [x + 0, %IsBeingInterpreted()]; }
+function f1(x) { return [x + 1, %IsBeingInterpreted()]; }
+function f2(x) { return [x + 2, %IsBeingInterpreted()]; }
+function f3(x) { return [x + 3, %IsBeingInterpreted()]; }
+function f4(x) { return [x + 4, %IsBeingInterpreted()]; }
+function f5(x) { return [x + 5, %IsBeingInterpreted()]; }
+
+function foo(i, x) {
+  let f;
+  switch (i) {
+    case 0: f = f0; break;
+    case 1: f = f1; break;
+    case 2: f = f2; break;
+    case 3: f = f3; break;
+    case 4: f = f4; break;
+    default: f = f5; break;
+  }
+  return f(x);
+}
+
+%PrepareFunctionForOptimization(f0);
+%PrepareFunctionForOptimization(f1);
+%PrepareFunctionForOptimization(f2);
+%PrepareFunctionForOptimization(f3);
+%PrepareFunctionForOptimization(f4);
+%PrepareFunctionForOptimization(f5);
+%PrepareFunctionForOptimization(foo);
+for (let i = 0; i < 6; ++i) assertEquals([10 + i, true], foo(i, 10));
+%OptimizeFunctionOnNextCall(foo);
+for (let i = 0; i < 6; ++i) assertEquals([10 + i, false], foo(i, 10));
+assertOptimized(foo);
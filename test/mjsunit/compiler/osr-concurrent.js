@@ -0,0 +1,57 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --concurrent-osr
+// Flags: --concurrent-recompilation
+
+// With concurrent OSR the loop keeps running in the interpreter while the OSR
+// code is compiled, and enters it at a later back edge. The result must not
+// depend on where the switch happens.
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+function f(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    var x = i + 2;
+    var y = x + 5;
+    var z = y + 3;
+    sum += z;
+    if (i == 11) %OptimizeOsr();
+  }
+  return sum;
+}
+
+for (var i = 0; i < 3; i++) {
+  %PrepareFunctionForOptimization(f);
+  assertEquals(509500, f(1000));
+  assertEquals(500009500000, f(1000000));
+}
+
+// The loop enters the OSR code once the job has been installed.
+function g(n) {
+  var sum = 0;
+  var entered = false;
+  for (var i = 0; i < n; i++) {
+    sum += i;
+    if (i == 11) %OptimizeOsr();
+    // Wait for the OSR job and install it. This re-arms the back edge.
+    if (i == 12) %GetOptimizationStatus(g);
+    if (i == 13) {
+      // Note: this check can't be wrapped in a function, because calling that
+      // function causes a deopt from lack of call feedback.
+      var opt_status = %GetOptimizationStatus(g);
+      entered = (opt_status &
+                 V8OptimizationStatus.kTopmostFrameIsTurboFanned) !== 0;
+    }
+  }
+  return entered ? sum : -1;
+}
+
+%PrepareFunctionForOptimization(g);
+var result = g(100);
+if (!isNeverOptimize()) assertEquals(4950, result);
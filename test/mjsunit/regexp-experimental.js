@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 // Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa
 
 function Test(regexp, subject, expectedResult, expectedLastIndex) {
   assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
@@ -96,3 +97,15 @@ Test(/x$/m, "x\na", ["x"], 0);
 
 // The dotall flag.
 Test(/asdf.xyz/s,  "asdf\nxyz", ["asdf\nxyz"], 0);
+
+// Subjects without a match are rejected by the lazy DFA; make sure it agrees
+// with the NFA interpreter on long, one-byte and two-byte subjects.
+Test(/(a|b)*c[0-9]/, "ab".repeat(1000), null, 0);
+Test(/(a|b)*c[0-9]/, "ab".repeat(1000) + "c7", ["ab".repeat(1000) + "c7", "b"],
+     0);
+Test(/x[쁰-섊]+y/, "x쁰섊x쁰".repeat(100), null, 0);
+Test(/x[쁰-섊]+y/, "x쁰섊x쁰".repeat(100) + "y", ["x쁰y"], 0);
+Test(/[^a]b/g, "aaaaab", null, 0);
+var r = /a.c/y;
+r.lastIndex = 1;
+Test(r, "abcabc", null, 0);
@@ -0,0 +1,45 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-interpret-all
+
+// Global replace, match and matchAll fetch interpreted matches in batches.
+// The batches must agree with one-match-at-a-time semantics, also across
+// batch boundaries and for zero-length matches.
+
+const n = 1000;  // More matches than fit into a single batch.
+const subject = "ab1".repeat(n);
+
+assertEquals("ab_".repeat(n), subject.replace(/\d/g, "_"));
+assertEquals("ab".repeat(n), subject.replace(/\d/g, ""));
+assertEquals("1ba".repeat(n), subject.replace(/(a)(b)(\d)/g, "$3$2$1"));
+assertEquals(n, subject.match(/b\d/g).length);
+assertEquals(3 * n + 1, subject.match(/(?:)/g).length);
+assertEquals("-a-b-1-", "ab1".replace(/(?:)/g, "-"));
+assertEquals("-ab-".repeat(n), subject.replace(/(?=a)|1/g, "-"));
+
+let count = 0;
+for (const m of subject.matchAll(/a(b)(x)?/g)) {
+  assertEquals(3 * count, m.index);
+  assertEquals("b", m[1]);
+  assertEquals(undefined, m[2]);
+  count++;
+}
+assertEquals(n, count);
+
+// Zero-length matches advance by a whole surrogate pair in unicode mode.
+assertEquals(["", "", ""], "\u{1F600}\u{1F600}".match(/(?:)/gu));
+assertEquals(["", "", "", "", ""], "\u{1F600}\u{1F600}".match(/(?:)/g));
+
+// A replacement function may run the same regexp while matches of the
+// current batch are still pending.
+const re = /\d/g;
+count = 0;
+assertEquals("ab*".repeat(n), subject.replace(re, (match) => {
+  assertEquals("1", match);
+  assertEquals("xy", "x1y".replace(re, ""));
+  count++;
+  return "*";
+}));
+assertEquals(n, count);
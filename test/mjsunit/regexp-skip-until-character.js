@@ -0,0 +1,47 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-regexp-tier-up --no-regexp-interpret-all
+
+// Unanchored searches for patterns with a single required character skip
+// ahead to the next occurrence of that character.  Characters that only agree
+// with it in the low seven bits must not be mistaken for it, and a match
+// close to or at the end of the subject must still be found.
+
+const filler = "-".repeat(10000);
+
+function test(re, subject, expected) {
+  const result = re.exec(subject);
+  assertEquals(expected, result === null ? null : result.index);
+}
+
+test(/x\d/, filler + "x1" + filler, filler.length);
+test(/x\d/, filler + "x", null);
+test(/x\d/, filler + "x1", filler.length);
+test(/x\d/, filler, null);
+test(/x\d/, "", null);
+// "ø" is "x" | 0x80.
+test(/x\d/, filler + "\xf8" + "1" + filler, null);
+test(/\xf8\d/, filler + "x1" + "\xf8" + "2", filler.length + 2);
+test(/x\d/, filler + "\xf8" + "x1", filler.length + 1);
+// A required character that isn't the first one of the match.
+test(/[a-z][a-z]q\d/, filler + "abq1", filler.length);
+test(/[a-z][a-z]q\d/, filler + "qq" + "abq", null);
+test(/[a-z][a-z]q\d/, "q1abq1", 2);
+
+// Global matching revisits the skip loop after every match.
+const subject = (filler + "x1").repeat(10) + filler;
+assertEquals(10, subject.match(/x\d/g).length);
+assertEquals(subject.replace(/x\d/g, ""),
+             filler.repeat(11));
+let last_index = 0;
+const re = /x\d/g;
+while (re.exec(subject) !== null) {
+  assertEquals("x", subject[re.lastIndex - 2]);
+  assertTrue(re.lastIndex > last_index);
+  last_index = re.lastIndex;
+}
+
+// Two-byte subjects keep using the stepping loop.
+test(/x\d/, "ሴ" + filler + "x1", filler.length + 1);
@@ -0,0 +1,64 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Appending short pieces to a cons string merges them into its sequential
+// right part. Check the result with pieces of both encodings and with pieces
+// that are too long to be merged.
+
+const kPieces = ["a", "bc", "δ", "<li>", "ε-ζ", "x".repeat(30), "☃",
+                 "y".repeat(70), "0123456789abcdef"];
+
+function build(n, offset) {
+  let s = "";
+  for (let i = 0; i < n; i++) {
+    s += kPieces[(i + offset) % kPieces.length];
+  }
+  return s;
+}
+
+function expected(n, offset) {
+  const parts = [];
+  for (let i = 0; i < n; i++) {
+    parts.push(kPieces[(i + offset) % kPieces.length]);
+  }
+  return parts.join("");
+}
+
+function check(n, offset) {
+  const s = build(n, offset);
+  const e = expected(n, offset);
+  assertEquals(e.length, s.length);
+  for (let i = 0; i < e.length; i += 11) {
+    assertEquals(e.charCodeAt(i), s.charCodeAt(i));
+  }
+  assertEquals(e, s);
+}
+
+%PrepareFunctionForOptimization(build);
+for (let offset = 0; offset < kPieces.length; offset++) {
+  check(1, offset);
+  check(20, offset);
+  check(300, offset);
+}
+%OptimizeFunctionOnNextCall(build);
+for (let offset = 0; offset < kPieces.length; offset++) {
+  check(1, offset);
+  check(20, offset);
+  check(300, offset);
+}
+
+// Appending to a string that is shared with another rope must not affect the
+// other rope.
+(function TestSharedPrefix() {
+  let base = "0123456789abcdef" + "ab";
+  const a = base + "cd";
+  const b = base + "ef";
+  const c = a + "gh";
+  assertEquals("0123456789abcdefab", base);
+  assertEquals("0123456789abcdefabcd", a);
+  assertEquals("0123456789abcdefabef", b);
+  assertEquals("0123456789abcdefabcdgh", c);
+})();
@@ -0,0 +1,66 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Flatten ropes that are unbalanced to the left and to the right, with
+// one-byte, two-byte and sliced leaves.
+
+const kLeaves = ["abc", "αβγ", "x", "☃", "0123456789".repeat(2)];
+
+function leaf(i) {
+  const s = kLeaves[i % kLeaves.length];
+  if (i % 7 == 3) {
+    // Make a sliced string.
+    const parent = "#".repeat(20) + s + "#".repeat(20);
+    return parent.substring(20, 20 + s.length);
+  }
+  return s;
+}
+
+(function TestAppend() {
+  let rope = "";
+  const parts = [];
+  for (let i = 0; i < 500; i++) {
+    rope += leaf(i);
+    parts.push(leaf(i));
+  }
+  const expected = parts.join("");
+  assertEquals(expected.length, rope.length);
+  %FlattenString(rope);
+  assertEquals(expected, rope);
+  for (let i = 0; i < expected.length; i += 17) {
+    assertEquals(expected.charCodeAt(i), rope.charCodeAt(i));
+  }
+})();
+
+(function TestPrepend() {
+  let rope = "";
+  const parts = [];
+  for (let i = 0; i < 500; i++) {
+    rope = leaf(i) + rope;
+    parts.unshift(leaf(i));
+  }
+  const expected = parts.join("");
+  assertEquals(expected.length, rope.length);
+  %FlattenString(rope);
+  assertEquals(expected, rope);
+  for (let i = 0; i < expected.length; i += 13) {
+    assertEquals(expected.charCodeAt(i), rope.charCodeAt(i));
+  }
+})();
+
+(function TestSubstringOfRope() {
+  let rope = "";
+  let expected = "";
+  for (let i = 0; i < 200; i++) {
+    const s = leaf(i);
+    rope = (i % 2 == 0) ? rope + s : s + rope;
+    expected = (i % 2 == 0) ? expected.concat(s) : s.concat(expected);
+  }
+  for (let start = 0; start < rope.length; start += 97) {
+    assertEquals(expected.substring(start, start + 150),
+                 rope.substring(start, start + 150));
+  }
+})();
@@ -0,0 +1,77 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-wasm-trap-handler
+
+// Repeated accesses to the same index share a single explicit bounds check in
+// TurboFan. Make sure the remaining check still covers the largest access and
+// that a memory.grow in between forces a fresh check.
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+function addLoadPairs(builder) {
+  // Larger access first, smaller access is covered by the first check.
+  builder.addFunction('load_wide_first', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0,
+        kExprI32LoadMem, 0, 8,
+        kExprLocalGet, 0,
+        kExprI32LoadMem8U, 0, 0,
+        kExprI32Add])
+      .exportFunc();
+  // Smaller access first, the larger access needs its own check.
+  builder.addFunction('load_narrow_first', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0,
+        kExprI32LoadMem8U, 0, 0,
+        kExprLocalGet, 0,
+        kExprI32LoadMem, 0, 8,
+        kExprI32Add])
+      .exportFunc();
+}
+
+(function TestNonGrowableMemory() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  addLoadPairs(builder);
+  const instance = builder.instantiate();
+  %WasmTierUpFunction(instance, 0);
+  %WasmTierUpFunction(instance, 1);
+  const last_valid = kPageSize - 8 - 4;
+  for (const f of [instance.exports.load_wide_first,
+                   instance.exports.load_narrow_first]) {
+    assertEquals(0, f(0));
+    assertEquals(0, f(last_valid));
+    assertTraps(kTrapMemOutOfBounds, () => f(last_valid + 1));
+    assertTraps(kTrapMemOutOfBounds, () => f(kPageSize));
+    assertTraps(kTrapMemOutOfBounds, () => f(-1));
+  }
+})();
+
+(function TestGrowBetweenAccesses() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 2, false);
+  builder.addFunction('load_grow_load', kSig_i_ii)
+      .addBody([
+        kExprLocalGet, 0,
+        kExprI32LoadMem, 0, 0,
+        kExprDrop,
+        kExprLocalGet, 1,
+        kExprMemoryGrow, kMemoryZero,
+        kExprDrop,
+        kExprLocalGet, 0,
+        kExprI32LoadMem, 0, 0])
+      .exportFunc();
+  const instance = builder.instantiate();
+  %WasmTierUpFunction(instance, 0);
+  const load_grow_load = instance.exports.load_grow_load;
+  // The first load is out of bounds before growing.
+  assertTraps(kTrapMemOutOfBounds, () => load_grow_load(kPageSize, 1));
+  // Now the memory has two pages; the same index is in bounds.
+  assertEquals(0, load_grow_load(kPageSize, 0));
+  assertEquals(0, load_grow_load(2 * kPageSize - 4, 1));
+  assertTraps(kTrapMemOutOfBounds, () => load_grow_load(2 * kPageSize, 0));
+})();
@@ -15,6 +15,7 @@
 #include "src/heap/local-heap.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -97,5 +98,76 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, HotFunctionsFirst) {
+  // Keep the jobs in the input queue until they are taken out below.
+  FlagScope<bool> block_concurrent_recompilation(
+      &FLAG_block_concurrent_recompilation, true);
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(
+      Compiler::Compile(fun, Compiler::CLEAR_EXCEPTION, &is_compiled_scope));
+  BlockingCompilationJob* warm = new BlockingCompilationJob(i_isolate(), fun);
+  warm->set_priority(2);
+  BlockingCompilationJob* cold = new BlockingCompilationJob(i_isolate(), fun);
+  cold->set_priority(1);
+  BlockingCompilationJob* hot = new BlockingCompilationJob(i_isolate(), fun);
+  hot->set_priority(5);
+  BlockingCompilationJob* also_warm =
+      new BlockingCompilationJob(i_isolate(), fun);
+  also_warm->set_priority(2);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  dispatcher.QueueForOptimization(warm);
+  dispatcher.QueueForOptimization(cold);
+  dispatcher.QueueForOptimization(hot);
+  dispatcher.QueueForOptimization(also_warm);
+
+  // The hottest job comes first, equally hot jobs in the order they were
+  // queued.
+  std::unique_ptr<OptimizedCompilationJob> first(
+      dispatcher.NextInput(nullptr));
+  std::unique_ptr<OptimizedCompilationJob> second(
+      dispatcher.NextInput(nullptr));
+  std::unique_ptr<OptimizedCompilationJob> third(
+      dispatcher.NextInput(nullptr));
+  std::unique_ptr<OptimizedCompilationJob> fourth(
+      dispatcher.NextInput(nullptr));
+  EXPECT_EQ(hot, first.get());
+  EXPECT_EQ(warm, second.get());
+  EXPECT_EQ(also_warm, third.get());
+  EXPECT_EQ(cold, fourth.get());
+  EXPECT_EQ(nullptr, dispatcher.NextInput(nullptr));
+
+  // The compile tasks posted when unblocking find the queue empty.
+  dispatcher.Stop();
+}
+
+TEST_F(OptimizingCompileDispatcherTest, PriorityFromProfilerTicks) {
+  FlagScope<bool> allow_natives_syntax(&FLAG_allow_natives_syntax, true);
+  FlagScope<bool> block_concurrent_recompilation(
+      &FLAG_block_concurrent_recompilation, true);
+  Handle<JSFunction> fun = RunJS<JSFunction>(
+      "function f(x) { return x + 1; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1); f(2);"
+      "f;");
+  fun->feedback_vector().set_profiler_ticks(7);
+  ASSERT_TRUE(Compiler::CompileOptimized(fun, ConcurrencyMode::kConcurrent,
+                                         CodeKind::TURBOFAN));
+  // The ticks are reset when the job is created, but the queued job still
+  // knows how hot the function was.
+  EXPECT_EQ(0, fun->feedback_vector().profiler_ticks());
+  OptimizingCompileDispatcher* dispatcher =
+      i_isolate()->optimizing_compile_dispatcher();
+  {
+    base::MutexGuard access_input_queue(&dispatcher->input_queue_mutex_);
+    ASSERT_EQ(1u, dispatcher->input_queue_.size());
+    EXPECT_EQ(7, dispatcher->input_queue_[0].priority);
+    EXPECT_EQ(7, dispatcher->input_queue_[0].job->priority());
+  }
+  dispatcher->Flush(BlockingBehavior::kBlock);
+}
+
 }  // namespace internal
 }  // namespace v8